@@ -201,6 +201,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/EclipseState/Tables/BrineDensityTable.cpp
     opm/input/eclipse/EclipseState/Tables/SolventDensityTable.cpp
     opm/input/eclipse/EclipseState/Tables/Tabdims.cpp
+    opm/input/eclipse/Parser/DeckCache.cpp
     opm/input/eclipse/Parser/ErrorGuard.cpp
     opm/input/eclipse/Parser/InputErrorAction.cpp
     opm/input/eclipse/Parser/ParseContext.cpp
@@ -396,7 +397,12 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list( APPEND MAIN_SOURCE_FILES
+          opm/io/eclipse/ByteSwap.cpp
+          opm/io/eclipse/ColESmry.cpp
+          opm/io/eclipse/ColSmryFormat.cpp
+          opm/io/eclipse/ColSmryOutput.cpp
           opm/io/eclipse/EclFile.cpp
+          opm/io/eclipse/EclFileIndex.cpp
           opm/io/eclipse/EclOutput.cpp
           opm/io/eclipse/EclUtil.cpp
           opm/io/eclipse/EGrid.cpp
@@ -409,6 +415,7 @@ if(ENABLE_ECL_OUTPUT)
           opm/io/eclipse/ESmry_write_rsm.cpp
           opm/io/eclipse/OutputStream.cpp
           opm/io/eclipse/ExtSmryOutput.cpp
+          opm/io/eclipse/MappedFile.cpp
           opm/io/eclipse/RestartFileView.cpp
           opm/io/eclipse/SummaryNode.cpp
           opm/io/eclipse/rst/action.cpp
@@ -518,6 +525,7 @@ if(ENABLE_ECL_INPUT)
     tests/test_ERsm.cpp
     tests/test_GuideRate.cpp
     tests/test_RestartFileView.cpp
+    tests/test_ColESmry.cpp
     tests/test_EclIO.cpp
     tests/test_EGrid.cpp
     tests/test_EInit.cpp
@@ -807,6 +815,7 @@ if(ENABLE_ECL_INPUT)
     tests/BASE.UNRST
   )
   list (APPEND EXAMPLE_SOURCE_FILES
+    examples/eclio_byteswap_bench.cpp
     examples/opmi.cpp
     examples/opmpack.cpp
     examples/opmhash.cpp
@@ -886,6 +895,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/platform_dependent/reenable_warnings.h
       opm/common/utility/shmatch.hpp
       opm/common/utility/Serializer.hpp
+      opm/common/utility/StableHash.hpp
       opm/common/utility/String.hpp
       opm/common/utility/TimeService.hpp
       opm/common/utility/VectorWithDefaultAllocator.hpp
@@ -1188,6 +1198,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Units/UnitSystem.hpp
        opm/input/eclipse/Units/Units.hpp
        opm/input/eclipse/Units/Dimension.hpp
+       opm/input/eclipse/Parser/DeckCache.hpp
        opm/input/eclipse/Parser/ErrorGuard.hpp
        opm/input/eclipse/Parser/ParserItem.hpp
        opm/input/eclipse/Parser/Parser.hpp
@@ -1473,7 +1484,13 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
+        opm/io/eclipse/ByteSwap.hpp
+        opm/io/eclipse/ColESmry.hpp
+        opm/io/eclipse/ColSmryFormat.hpp
+        opm/io/eclipse/ColSmryOutput.hpp
+        opm/io/eclipse/EclArrayView.hpp
         opm/io/eclipse/EclFile.hpp
+        opm/io/eclipse/EclFileIndex.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
         opm/io/eclipse/EclUtil.hpp
@@ -1487,6 +1504,7 @@ if(ENABLE_ECL_OUTPUT)
         opm/io/eclipse/PaddedOutputString.hpp
         opm/io/eclipse/OutputStream.hpp
         opm/io/eclipse/ExtSmryOutput.hpp
+        opm/io/eclipse/MappedFile.hpp
         opm/io/eclipse/RestartFileView.hpp
         opm/io/eclipse/SummaryNode.hpp
         opm/io/eclipse/rst/action.hpp
@@ -0,0 +1,157 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/ByteSwap.hpp>
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <getopt.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMicro-benchmark of the big-endian conversion used for unformatted ECLIPSE files.\n"
+              << "Reports throughput in GB/s of the bulk kernels, of the element wise flipEndian\n"
+              << "functions, and of writing and reading complete arrays through a scratch file.\n"
+              << "\nIn addition, the program takes these options:\n\n"
+              << "-n Number of elements per array, default 16777216.\n"
+              << "-r Number of repetitions, default 10.\n"
+              << "-f Scratch file, default BYTESWAP_BENCH.DAT in the current directory.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+template <typename F>
+double gigabytesPerSecond(const std::size_t bytes, const int repeat, F&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int r = 0; r < repeat; ++r) {
+        f();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return static_cast<double>(bytes) * repeat / elapsed.count() / 1.0e9;
+}
+
+template <typename T>
+void benchmark(const std::string& typeName, const std::size_t n, const int repeat,
+               const std::string& scratch)
+{
+    std::vector<T> data(n);
+    std::iota(data.begin(), data.end(), T{1});
+
+    std::vector<T> out(n);
+    const auto bytes = n * sizeof(T);
+
+    const auto bulk = gigabytesPerSecond(bytes, repeat, [&]() {
+        if constexpr (sizeof(T) == 8) {
+            Opm::EclIO::byteSwap64(data.data(), out.data(), n);
+        } else {
+            Opm::EclIO::byteSwap32(data.data(), out.data(), n);
+        }
+    });
+
+    const auto scalar = gigabytesPerSecond(bytes, repeat, [&]() {
+        for (std::size_t i = 0; i < n; ++i) {
+            if constexpr (std::is_same_v<T, int>) {
+                out[i] = Opm::EclIO::flipEndianInt(data[i]);
+            } else if constexpr (std::is_same_v<T, float>) {
+                out[i] = Opm::EclIO::flipEndianFloat(data[i]);
+            } else {
+                out[i] = Opm::EclIO::flipEndianDouble(data[i]);
+            }
+        }
+    });
+
+    const auto write = gigabytesPerSecond(bytes, repeat, [&]() {
+        Opm::EclIO::EclOutput output(scratch, false);
+        output.write("DATA", data);
+    });
+
+    bool equal = true;
+    const auto read = gigabytesPerSecond(bytes, repeat, [&]() {
+        Opm::EclIO::EclFile input(scratch);
+        input.loadData(0);
+        equal = equal && (input.get<T>(0) == data);
+    });
+
+    std::cout << fmt::format("{:<6} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f}{}\n",
+                             typeName, bulk, scalar, write, read,
+                             equal ? "" : "  (MISMATCH)");
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t n = 16777216;
+    int repeat = 10;
+    std::string scratch = "BYTESWAP_BENCH.DAT";
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "n:r:f:h")) != -1) {
+        switch (c) {
+        case 'n':
+            n = std::stoul(optarg);
+            break;
+        case 'r':
+            repeat = std::stoi(optarg);
+            break;
+        case 'f':
+            scratch = optarg;
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cout << fmt::format("Kernel: {}, {} elements, {} repetitions\n\n",
+                             Opm::EclIO::byteSwapKernel(), n, repeat);
+
+    std::cout << fmt::format("{:<6} {:>10} {:>10} {:>10} {:>10}\n",
+                             "Type", "bulk", "scalar", "write", "read");
+    std::cout << fmt::format("{:<6} {:>10} {:>10} {:>10} {:>10}\n",
+                             "", "GB/s", "GB/s", "GB/s", "GB/s");
+
+    benchmark<int>("INTE", n, repeat, scratch);
+    benchmark<float>("REAL", n, repeat, scratch);
+    benchmark<double>("DOUB", n, repeat, scratch);
+
+    std::filesystem::remove(scratch);
+
+    return EXIT_SUCCESS;
+}
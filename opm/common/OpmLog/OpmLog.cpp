@@ -21,6 +21,7 @@
 #include <opm/common/OpmLog/Logger.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
 #include <iostream>
+#include <mutex>
 #include <errno.h>  // For errno
 #include <stdio.h>  // For fileno() and stdout
 
@@ -38,6 +39,14 @@
 #include <unistd.h> // For isatty()
 #endif
 
+namespace {
+
+    // Messages may be added from more than one thread, e.g., by the
+    // asynchronous output writer of EclipseIO.
+    std::mutex message_mutex;
+
+} // Anonymous namespace
+
 namespace Opm {
 
     bool OpmLog::stdoutIsTerminal()
@@ -73,12 +82,14 @@ namespace Opm {
 
 
     void OpmLog::addMessage(int64_t messageFlag , const std::string& message) {
+        std::lock_guard<std::mutex> lock(message_mutex);
         if (m_logger)
             m_logger->addMessage( messageFlag , message );
     }
 
 
     void OpmLog::addTaggedMessage(int64_t messageFlag, const std::string& tag, const std::string& message) {
+        std::lock_guard<std::mutex> lock(message_mutex);
         if (m_logger)
             m_logger->addTaggedMessage( messageFlag, tag, message );
     }
@@ -36,6 +36,10 @@ namespace Opm {
 /*
   The OpmLog class is a fully static class which manages a proper
   Logger instance.
+
+  Messages may be added concurrently from several threads.  Setting up
+  the logger, i.e., adding or removing backends and message types, is
+  not thread-safe and must be done while no messages are added.
 */
 
 
@@ -0,0 +1,47 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_STABLE_HASH_HPP
+#define OPM_UTILITY_STABLE_HASH_HPP
+
+#include <cstdint>
+#include <string_view>
+
+namespace Opm {
+
+/// 64 bit FNV-1a hash of \p data.
+///
+/// Unlike std::hash the result is the same for every build, standard
+/// library and platform, so it may be stored on disk.  Pass the hash of
+/// preceding data as \p seed to hash data in pieces.
+inline std::uint64_t stableHash(std::string_view data,
+                                std::uint64_t seed = 0xcbf29ce484222325ULL)
+{
+    auto hash = seed;
+    for (const auto c : data) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+} // namespace Opm
+
+#endif // OPM_UTILITY_STABLE_HASH_HPP
@@ -32,9 +32,13 @@ namespace Opm {
 
     std::vector< const DeckKeyword* > Deck::getKeywordList( const std::string& keyword ) const {
         std::vector<const DeckKeyword *> pointers;
-        auto view = this->global_view().operator[](keyword);
-        std::transform(view.begin(), view.end(), std::back_inserter(pointers),
-                       [](const auto& kw) { return &kw; });
+        const auto* positions = this->keyword_positions(keyword);
+        if (positions == nullptr)
+            return pointers;
+
+        pointers.reserve(positions->size());
+        std::transform(positions->begin(), positions->end(), std::back_inserter(pointers),
+                       [this](const std::size_t index) { return &this->keywordList[index]; });
         return pointers;
     }
 
@@ -48,21 +52,48 @@ namespace Opm {
 
 
 std::size_t Deck::count(const std::string& keyword) const {
-    return this->global_view().count(keyword);
+    const auto* positions = this->keyword_positions(keyword);
+    return (positions == nullptr) ? 0 : positions->size();
+}
+
+const std::vector<std::size_t> Deck::index(const std::string& keyword) const {
+    const auto* positions = this->keyword_positions(keyword);
+    return (positions == nullptr) ? std::vector<std::size_t>{} : *positions;
 }
 
-const DeckView& Deck::global_view() const {
-    if (!this->m_global_view) {
-        this->m_global_view = std::make_unique<DeckView>();
-        for (const auto& kw : this->keywordList)
-            this->m_global_view->add_keyword(kw);
+const Deck::KeywordIndex& Deck::keyword_index() const {
+    for (; this->m_indexed_size < this->keywordList.size(); ++this->m_indexed_size) {
+        const auto& name = this->keywordList[this->m_indexed_size].name();
+        this->m_keyword_index[name].push_back(this->m_indexed_size);
     }
-    return *this->m_global_view;
+    return this->m_keyword_index;
+}
+
+const std::vector<std::size_t>* Deck::keyword_positions(const std::string& keyword) const {
+    const auto& index = this->keyword_index();
+    auto iter = index.find(keyword);
+    return (iter == index.end()) ? nullptr : &iter->second;
+}
+
+void Deck::reset_index() {
+    this->m_keyword_index.clear();
+    this->m_indexed_size = 0;
+}
+
+void Deck::remove_keywords(int from, int to) {
+    this->keywordList.erase(this->keywordList.begin() + from, this->keywordList.begin() + to);
+    this->reset_index();
 }
 
     Opm::DeckView Deck::operator[](const std::string& keyword) const {
-        return this->global_view()[keyword];
-    } 
+        DeckView view;
+        const auto* positions = this->keyword_positions(keyword);
+        if (positions != nullptr) {
+            for (const auto& index : *positions)
+                view.add_keyword(this->keywordList[index]);
+        }
+        return view;
+    }
 
     const DeckKeyword& Deck::operator[](std::size_t index) const {
         return this->keywordList.at(index);
@@ -88,7 +119,10 @@ const DeckView& Deck::global_view() const {
         , input_path( d.input_path )
         , file_tree( std::move(d.file_tree) )
         , unit_system_access_count(d.unit_system_access_count)
+        , m_keyword_index( std::move(d.m_keyword_index) )
+        , m_indexed_size( d.m_indexed_size )
     {
+        d.reset_index();
     }
 
     Deck Deck::serializationTestObject()
@@ -115,7 +149,6 @@ const DeckView& Deck::global_view() const {
             this->selectActiveUnitSystem( UnitSystem::UnitType::UNIT_TYPE_PVT_M );
 
         this->keywordList.push_back( std::move( keyword ) );
-        this->m_global_view = nullptr;
     }
 
     void Deck::addKeyword( const DeckKeyword& keyword ) {
@@ -227,6 +260,7 @@ const DeckView& Deck::global_view() const {
         input_path = data.input_path;
         unit_system_access_count = data.unit_system_access_count;
         activeUnits = data.activeUnits;
+        this->reset_index();
 
         return *this;
     }
@@ -260,7 +294,7 @@ const DeckView& Deck::global_view() const {
     }
 
     bool Deck::hasKeyword(const std::string& keyword) const {
-        return this->global_view().has_keyword(keyword);
+        return this->keyword_positions(keyword) != nullptr;
     }
 
 }
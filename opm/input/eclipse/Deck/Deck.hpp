@@ -29,6 +29,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Opm {
@@ -105,6 +106,7 @@ namespace Opm {
                 serializer(m_dataFile);
                 serializer(input_path);
                 serializer(unit_system_access_count);
+                this->reset_index();
             }
 
             bool hasKeyword( const std::string& keyword ) const;
@@ -116,9 +118,7 @@ namespace Opm {
 
 
 
-            const std::vector<std::size_t> index(const std::string& keyword) const {
-                return this->global_view().index(keyword);
-            }
+            const std::vector<std::size_t> index(const std::string& keyword) const;
 
             template< class Keyword >
             std::size_t count() const {
@@ -126,7 +126,7 @@ namespace Opm {
             }
             size_t count(const std::string& keyword) const;
 
-            void remove_keywords(int from, int to) { keywordList.erase(keywordList.begin() +from, keywordList.begin() + to); };     
+            void remove_keywords(int from, int to);
 
         private:
 
@@ -139,8 +139,19 @@ namespace Opm {
             DeckTree file_tree;
             mutable std::size_t unit_system_access_count = 0;
 
-            const DeckView& global_view() const;
-            mutable std::unique_ptr<DeckView> m_global_view{nullptr};
+            /*
+              Positions of the instances of every keyword in keywordList. The
+              index covers the first m_indexed_size keywords and is extended
+              on demand, so adding keywords while the deck is queried, as the
+              parser does, only indexes every keyword once.
+            */
+            using KeywordIndex = std::unordered_map<std::string, std::vector<std::size_t>>;
+            const KeywordIndex& keyword_index() const;
+            const std::vector<std::size_t>* keyword_positions(const std::string& keyword) const;
+            void reset_index();
+
+            mutable KeywordIndex m_keyword_index;
+            mutable std::size_t m_indexed_size = 0;
     };
 }
 #endif  /* DECK_HPP */
@@ -24,9 +24,49 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <ostream>
 #include <string>
 #include <stdexcept>
+#include <utility>
+
+namespace {
+
+/*
+  Unit conversion of the double data of an item with a single dimension,
+  i.e. the data of ZCORN, PORO, PERMX and friends. The scaling factors are
+  looked up once for the whole item instead of once per value and the
+  values are converted in place, in parallel for large items; the only
+  per value state is whether the value was defaulted. Dimension lookups
+  throw for context dependent units, they are therefore done before the
+  parallel loop, and only for the dimensions which are actually used.
+*/
+template< typename Convert >
+void convert_single_dimension( std::vector< double >& data,
+                               const std::vector< Opm::value::status >& status,
+                               const Opm::Dimension& active_dim,
+                               const Opm::Dimension& default_dim,
+                               Convert convert ) {
+    const bool has_default = std::any_of( status.begin(), status.end(), Opm::value::defaulted );
+    const bool has_value = !std::all_of( status.begin(), status.end(), Opm::value::defaulted );
+
+    const auto active = has_value
+        ? std::make_pair( active_dim.getSIScaling(), active_dim.getSIOffset() )
+        : std::make_pair( 1.0, 0.0 );
+    const auto defaulted = has_default
+        ? std::make_pair( default_dim.getSIScaling(), default_dim.getSIOffset() )
+        : active;
+
+    const auto size = static_cast< std::ptrdiff_t >( data.size() );
+
+#pragma omp parallel for schedule(static) if(size > (1 << 16))
+    for( std::ptrdiff_t index = 0; index < size; ++index ) {
+        const auto& [factor, offset] = Opm::value::defaulted( status[index] ) ? defaulted : active;
+        data[index] = convert( data[index], factor, offset );
+    }
+}
+
+}
 
 namespace Opm {
 
@@ -307,6 +347,31 @@ void DeckItem::push_backDefault( UDAValue x, std::size_t n ) {
 }
 
 
+template< typename T >
+void DeckItem::push_back( std::vector< T >&& values, std::vector< value::status >&& status ) {
+    if( values.size() != status.size() )
+        throw std::logic_error("Number of values and value status must agree");
+
+    // The first block takes over the buffers instead of copying them.
+    auto& val = this->value_ref< T >();
+    if( val.empty() && this->value_status.empty() ) {
+        val = std::move( values );
+        this->value_status = std::move( status );
+        return;
+    }
+
+    // Later blocks are appended.  Grow geometrically so that a sequence
+    // of blocks is not reallocated once per block.
+    const auto size = val.size() + values.size();
+    if( size > val.capacity() ) {
+        val.reserve( std::max( size, 2 * val.capacity() ) );
+        this->value_status.reserve( std::max( size, 2 * this->value_status.capacity() ) );
+    }
+
+    val.insert( val.end(), std::make_move_iterator( values.begin() ), std::make_move_iterator( values.end() ) );
+    this->value_status.insert( this->value_status.end(), status.begin(), status.end() );
+}
+
 template<typename T>
 void DeckItem::push_backDummyDefault( std::size_t n ) {
     auto& val = this->value_ref< T >();
@@ -329,6 +394,16 @@ const std::vector<double>& DeckItem::getData() const {
         return data;
 
     const auto dim_size = this->active_dimensions.size();
+    if ((dim_size == 1) && (this->default_dimensions.size() == 1)) {
+        convert_single_dimension(data, this->value_status,
+                                 this->active_dimensions.front(),
+                                 this->default_dimensions.front(),
+                                 [](double value, double factor, double offset)
+                                 { return (value - offset) / factor; });
+        this->raw_data = true;
+        return data;
+    }
+
     for( size_t index = 0; index < data.size(); index++ ) {
         const auto dimIndex = index % dim_size;
         if (value::defaulted(this->value_status[index])) {
@@ -362,6 +437,16 @@ const std::vector<double>& DeckItem::getSIDoubleData() const
     // SI units, so externally the object still behaves as const.
 
     const auto dim_size = this->active_dimensions.size();
+    if ((dim_size == 1) && (this->default_dimensions.size() == 1)) {
+        convert_single_dimension(data, this->value_status,
+                                 this->active_dimensions.front(),
+                                 this->default_dimensions.front(),
+                                 [](double value, double factor, double offset)
+                                 { return value * factor + offset; });
+        this->raw_data = false;
+        return data;
+    }
+
     const auto sz = data.size();
     for (auto index = 0*sz; index < sz; ++index) {
         const auto& dim = value::defaulted(this->value_status[index])
@@ -554,6 +639,9 @@ template double DeckItem::get< double >( size_t ) const;
 template std::string DeckItem::get< std::string >( size_t ) const;
 template RawString DeckItem::get< RawString >( size_t ) const;
 
+template void DeckItem::push_back<int>( std::vector<int>&&, std::vector<value::status>&& );
+template void DeckItem::push_back<double>( std::vector<double>&&, std::vector<value::status>&& );
+
 template void DeckItem::push_backDummyDefault<int>( std::size_t );
 template void DeckItem::push_backDummyDefault<double>( std::size_t );
 template void DeckItem::push_backDummyDefault<std::string>( std::size_t );
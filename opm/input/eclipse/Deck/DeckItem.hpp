@@ -99,6 +99,14 @@ namespace Opm {
         void push_backDefault( double, std::size_t n = 1 );
         void push_backDefault( std::string, std::size_t n = 1 );
         void push_backDefault( RawString, std::size_t n = 1 );
+
+        // Appends a block of values with their corresponding value status,
+        // used by the parser for large numeric items.  An empty item takes
+        // over the buffers without copying, otherwise the block is appended
+        // with amortised growth.  The parser hands over each numeric item as
+        // a single block.
+        template <typename T>
+        void push_back( std::vector<T>&& values, std::vector<value::status>&& status );
         // trying to access the data of a "dummy default item" will raise an exception
 
         template <typename T>
@@ -58,36 +58,25 @@ namespace {
         }
 
         auto start_index = deck.index(section).front();
-        std::unordered_set<std::string> end_set;
-        {
-            auto this_section_index = section_index.at(section);
 
-            for (const auto& [section_name, index] : section_index) {
-                if (index > this_section_index) {
-                    end_set.insert(section_name);
-                }
-            }
-        }
-
-        if (end_set.empty()) {
-            return {start_index, deck.size()};
-        }
-
-        std::size_t deck_index = start_index;
-        while (true) {
-            const auto& kw = deck[deck_index];
-            if (end_set.count(kw.name()) == 1) {
-                break;
+        // The section ends at the first instance of a later section
+        // keyword, looked up in the keyword index of the deck.
+        std::size_t end_index = deck.size();
+        const auto this_section_index = section_index.at(section);
+        for (const auto& [section_name, index] : section_index) {
+            if (index <= this_section_index) {
+                continue;
             }
 
-            ++deck_index;
-
-            if (deck_index == deck.size()) {
-                break;
+            for (const auto& kw_index : deck.index(section_name)) {
+                if (kw_index > start_index) {
+                    end_index = std::min(end_index, kw_index);
+                    break;
+                }
             }
         }
 
-        return {start_index, deck_index};
+        return {start_index, end_index};
     }
 
 } // Anonymous namespace
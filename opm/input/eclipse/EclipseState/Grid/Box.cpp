@@ -99,6 +99,12 @@ namespace Opm
     }
 
     void Box::update(const DeckRecord& deckRecord)
+    {
+        const auto [i1, i2, j1, j2, k1, k2] = this->extents(deckRecord);
+        this->init(i1, i2, j1, j2, k1, k2);
+    }
+
+    std::array<int, 6> Box::extents(const DeckRecord& deckRecord) const
     {
         auto default_count = 0;
 
@@ -117,9 +123,11 @@ namespace Opm
         default_count += update_default(deckRecord.getItem<ParserKeywords::BOX::K1>(), k1);
         default_count += update_default(deckRecord.getItem<ParserKeywords::BOX::K2>(), k2);
 
-        if (default_count != 6) {
-            this->init(i1, i2, j1, j2, k1, k2);
+        if (default_count == 6) {
+            return { this->I1(), this->I2(), this->J1(), this->J2(), this->K1(), this->K2() };
         }
+
+        return { i1, i2, j1, j2, k1, k2 };
     }
 
     void Box::reset()
@@ -137,13 +145,24 @@ namespace Opm
         assert_dims(this->m_globalGridDims_.getNY(), j1, j2);
         assert_dims(this->m_globalGridDims_.getNZ(), k1, k2);
 
-        this->m_dims[0] = static_cast<std::size_t>(i2 - i1 + 1);
-        this->m_dims[1] = static_cast<std::size_t>(j2 - j1 + 1);
-        this->m_dims[2] = static_cast<std::size_t>(k2 - k1 + 1);
+        // Consecutive records of an operation keyword often use the same
+        // box; the index lists are then still valid.
+        const auto dims = std::array<std::size_t, 3> {
+            static_cast<std::size_t>(i2 - i1 + 1),
+            static_cast<std::size_t>(j2 - j1 + 1),
+            static_cast<std::size_t>(k2 - k1 + 1),
+        };
+        const auto offset = std::array<std::size_t, 3> {
+            static_cast<std::size_t>(i1),
+            static_cast<std::size_t>(j1),
+            static_cast<std::size_t>(k1),
+        };
+        if ((dims == this->m_dims) && (offset == this->m_offset)) {
+            return;
+        }
 
-        this->m_offset[0] = static_cast<std::size_t>(i1);
-        this->m_offset[1] = static_cast<std::size_t>(j1);
-        this->m_offset[2] = static_cast<std::size_t>(k1);
+        this->m_dims = dims;
+        this->m_offset = offset;
 
         this->initIndexList();
     }
@@ -75,6 +75,10 @@ namespace Opm
             int k1, int k2);
 
         void update(const DeckRecord& deckRecord);
+
+        /// The zero based box (I1, I2, J1, J2, K1, K2) which update() would
+        /// select for deckRecord, without changing this box.
+        std::array<int, 6> extents(const DeckRecord& deckRecord) const;
         void reset();
 
         bool isGlobal() const;
@@ -64,12 +64,14 @@
 #include <opm/input/eclipse/Parser/ParserKeywords/Z.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <cstring>
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <memory>
 #include <numeric>
 #include <tuple>
 #include <stdexcept>
@@ -156,7 +158,7 @@ EclipseGrid::EclipseGrid(const GridDims& gd)
       m_pinchMaxEmptyGap(ParserKeywords::PINCH::MAX_EMPTY_GAP::defaultValue)
 {
     this->m_nactive = this->getCartesianSize();
-    this->active_volume = std::nullopt;
+    this->resetActiveGeometry();
     // Nothing else initialized. Leaving in particular as empty:
     // m_actnum,
     // m_global_to_active,
@@ -238,8 +240,7 @@ EclipseGrid::EclipseGrid(const EclipseGrid& src, const double* zcorn, const std:
             m_zcorn[n] = zcorn[n];
         }
 
-        ZcornMapper mapper( getNX(), getNY(), getNZ());
-        zcorn_fixed = mapper.fixupZCORN( m_zcorn );
+        zcorn_fixed = this->fixupZCORN();
     }
 
     resetACTNUM(actnum);
@@ -324,6 +325,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             throw OpmInputError(fmt::format("Invalid length specifier: [{}]", length_unit), kw.location());
 
         if (grid_units.value() != deck.getActiveUnitSystem()) {
+            this->resetActiveGeometry();
             apply_GRIDUNIT(deck.getActiveUnitSystem(), grid_units.value(), this->m_zcorn);
             apply_GRIDUNIT(deck.getActiveUnitSystem(), grid_units.value(), this->m_coord);
             if (this->m_rv.has_value())
@@ -524,8 +526,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             this->m_mapaxes = std::make_optional<MapAxes>(egridfile);
         }
 
-        ZcornMapper mapper(getNX(), getNY(), getNZ());
-        zcorn_fixed = mapper.fixupZCORN(m_zcorn);
+        zcorn_fixed = this->fixupZCORN();
     }
 
     bool EclipseGrid::keywInputBeforeGdfile(const Deck& deck, const std::string& keyword) const {
@@ -678,8 +679,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
         m_coord = makeCoordDxvDyvDzvDepthz(DXV, DYV, DZV, DEPTHZ);
         m_zcorn = makeZcornDzvDepthz(DZV, DEPTHZ);
 
-        ZcornMapper mapper( getNX(), getNY(), getNZ());
-        zcorn_fixed = mapper.fixupZCORN( m_zcorn );
+        zcorn_fixed = this->fixupZCORN();
     }
 
     void EclipseGrid::initDTOPSGrid(const Deck& deck) {
@@ -693,8 +693,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
         m_coord = makeCoordDxDyDzTops(DX, DY, DZ, TOPS);
         m_zcorn = makeZcornDzTops(DZ, TOPS);
 
-        ZcornMapper mapper( getNX(), getNY(), getNZ());
-        zcorn_fixed = mapper.fixupZCORN( m_zcorn );
+        zcorn_fixed = this->fixupZCORN();
     }
 
 
@@ -1232,8 +1231,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
         m_input_coord = coord;
         m_input_zcorn = zcorn;
 
-        ZcornMapper mapper( getNX(), getNY(), getNZ());
-        zcorn_fixed = mapper.fixupZCORN( m_zcorn );
+        zcorn_fixed = this->fixupZCORN();
         this->resetACTNUM(actnum);
     }
 
@@ -1551,38 +1549,157 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return m_minpvMode == MinpvMode::Inactive || cell_porv >= m_minpvVector[globalIndex];
     }
 
-    const std::vector<double>& EclipseGrid::activeVolume() const {
-        if (!this->active_volume.has_value()) {
-            std::vector<double> volume(this->m_nactive);
-
-            #pragma omp parallel for schedule(static)
-            for (std::int64_t active_index = 0; active_index < static_cast<std::int64_t>(this->m_active_to_global.size()); active_index++) {
-                std::array<double,8> X;
-                std::array<double,8> Y;
-                std::array<double,8> Z;
-                auto global_index = this->m_active_to_global[active_index];
-                this->getCellCorners(global_index, X, Y, Z );
-                if (m_rv && m_thetav) {
-                    const auto[i,j,k] = this->getIJK(global_index);
-                    const auto& r = *m_rv;
-                    const auto& t = *m_thetav;
-                    volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-                } else
-                    volume[active_index] = calculateCellVol(X, Y, Z);
+    /*
+      The geometry of all active cells is computed in one pass over the
+      layers of the grid. The pillar lines are only evaluated once, the
+      corner depths of a cell are read directly from ZCORN, and the
+      volume, center and depth of a cell are all derived from the same
+      corners. The results are identical to the ones of the corresponding
+      single cell calculations based on getCellCorners(). With volume_only
+      the depths and centers are neither computed nor allocated.
+    */
+    EclipseGrid::ActiveGeometry EclipseGrid::sweepActiveGeometry(const bool volume_only) const {
+        const auto nx = static_cast<std::size_t>(this->getNX());
+        const auto ny = static_cast<std::size_t>(this->getNY());
+        const auto nz = static_cast<std::size_t>(this->getNZ());
+
+        ActiveGeometry geometry;
+        geometry.volume.resize(this->m_nactive);
+        if (!volume_only) {
+            geometry.depth.resize(this->m_nactive);
+            geometry.center.resize(this->m_nactive);
+        }
+
+        if (this->m_global_to_active.empty() || this->m_zcorn.empty()) {
+            return geometry;
+        }
+
+        // Pillar top points and the horizontal displacement per unit depth
+        // along the pillars.
+        const std::size_t num_pillars = (nx + 1) * (ny + 1);
+        std::vector<double> pillar_x(num_pillars);
+        std::vector<double> pillar_y(num_pillars);
+        std::vector<double> pillar_z(num_pillars);
+        std::vector<double> slope_x(num_pillars);
+        std::vector<double> slope_y(num_pillars);
+
+        for (std::size_t p = 0; p < num_pillars; ++p) {
+            const double* pillar = &this->m_coord[6 * p];
+            pillar_x[p] = pillar[0];
+            pillar_y[p] = pillar[1];
+            pillar_z[p] = pillar[2];
+
+            const double zb = pillar[5];
+            slope_x[p] = (pillar[2] == zb) ? 0.0 : (pillar[3] - pillar[0]) / (pillar[2] - zb);
+            slope_y[p] = (pillar[2] == zb) ? 0.0 : (pillar[4] - pillar[1]) / (pillar[2] - zb);
+        }
+
+        const bool radial = this->m_rv.has_value() && this->m_thetav.has_value();
+
+        #pragma omp parallel for schedule(static)
+        for (std::int64_t k = 0; k < static_cast<std::int64_t>(nz); ++k) {
+            std::array<double,8> X;
+            std::array<double,8> Y;
+            std::array<double,8> Z;
+
+            for (std::size_t j = 0; j < ny; ++j) {
+                for (std::size_t i = 0; i < nx; ++i) {
+                    const std::size_t global_index = i + j*nx + k*nx*ny;
+                    const int active_index = this->m_global_to_active[global_index];
+                    if (active_index < 0) {
+                        continue;
+                    }
+
+                    const std::size_t top = k*nx*ny*8 + j*nx*4 + i*2;
+                    const std::size_t bottom = top + nx*ny*4;
+                    const std::array<std::size_t,4> zind {{ top, top + 1, top + nx*2, top + nx*2 + 1 }};
+
+                    const std::size_t p0 = j*(nx + 1) + i;
+                    const std::array<std::size_t,4> pind {{ p0, p0 + 1, p0 + nx + 1, p0 + nx + 2 }};
+
+                    for (int n = 0; n < 4; ++n) {
+                        Z[n]     = this->m_zcorn[zind[n]];
+                        Z[n + 4] = this->m_zcorn[zind[n] - top + bottom];
+
+                        const auto p = pind[n];
+                        X[n]     = (slope_x[p] == 0.0) ? pillar_x[p] : pillar_x[p] + slope_x[p] * (pillar_z[p] - Z[n]);
+                        X[n + 4] = (slope_x[p] == 0.0) ? pillar_x[p] : pillar_x[p] + slope_x[p] * (pillar_z[p] - Z[n + 4]);
+                        Y[n]     = (slope_y[p] == 0.0) ? pillar_y[p] : pillar_y[p] + slope_y[p] * (pillar_z[p] - Z[n]);
+                        Y[n + 4] = (slope_y[p] == 0.0) ? pillar_y[p] : pillar_y[p] + slope_y[p] * (pillar_z[p] - Z[n + 4]);
+                    }
+
+                    if (radial) {
+                        const auto& r = *this->m_rv;
+                        const auto& t = *this->m_thetav;
+                        geometry.volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
+                    } else {
+                        geometry.volume[active_index] = calculateCellVol(X, Y, Z);
+                    }
+
+                    if (volume_only) {
+                        continue;
+                    }
+
+                    const double z1 = (Z[0] + Z[1] + Z[2] + Z[3]) / 4.0;
+                    const double z2 = (Z[4] + Z[5] + Z[6] + Z[7]) / 4.0;
+                    geometry.depth[active_index] = (z1 + z2) / 2.0;
+
+                    geometry.center[active_index] = {{ std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
+                                                       std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
+                                                       std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 }};
+                }
             }
+        }
+
+        return geometry;
+    }
+
+    void EclipseGrid::computeActiveGeometry() {
+        this->active_geometry = this->sweepActiveGeometry(false);
+        std::atomic_store(&this->active_volume, std::shared_ptr<const std::vector<double>>{});
+    }
+
+    void EclipseGrid::resetActiveGeometry() {
+        this->active_geometry = std::nullopt;
+        std::atomic_store(&this->active_volume, std::shared_ptr<const std::vector<double>>{});
+    }
+
+    // Whether the geometry of the cell is stored by computeActiveGeometry().
+    // Other queries take the single cell path, so a query for a few cells
+    // never costs a sweep over the whole grid.
+    bool EclipseGrid::hasActiveGeometry(std::size_t globalIndex) const {
+        return this->active_geometry.has_value()
+            && !this->m_global_to_active.empty()
+            && !this->m_zcorn.empty()
+            && this->cellActive(globalIndex);
+    }
+
+    const std::vector<double>& EclipseGrid::activeVolume() const {
+        if (this->active_geometry.has_value()) {
+            return this->active_geometry->volume;
+        }
+
+        if (const auto volume = std::atomic_load(&this->active_volume); volume) {
+            return *volume;
+        }
 
-            this->active_volume = std::move(volume);
+        // Concurrent first callers may all sweep the grid, but only the
+        // first result is published and returned.
+        auto computed = std::make_shared<const std::vector<double>>
+            (this->sweepActiveGeometry(true).volume);
+        auto expected = std::shared_ptr<const std::vector<double>>{};
+        if (std::atomic_compare_exchange_strong(&this->active_volume, &expected, computed)) {
+            return *computed;
         }
 
-        return this->active_volume.value();
+        return *expected;
     }
 
 
     double EclipseGrid::getCellVolume(std::size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
-        if (this->cellActive(globalIndex) && this->active_volume.has_value()) {
-            auto active_index = this->activeIndex(globalIndex);
-            return this->active_volume.value()[active_index];
+        if (this->hasActiveGeometry(globalIndex)) {
+            return this->active_geometry->volume[this->activeIndex(globalIndex)];
         }
 
         std::array<double,8> X;
@@ -1721,6 +1838,10 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     std::array<double, 3> EclipseGrid::getCellCenter(std::size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        if (this->hasActiveGeometry(globalIndex)) {
+            return this->active_geometry->center[this->activeIndex(globalIndex)];
+        }
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
@@ -1822,6 +1943,10 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     double EclipseGrid::computeCellGeometricDepth(std::size_t globalIndex) const {
+        if (this->hasActiveGeometry(globalIndex)) {
+            return this->active_geometry->depth[this->activeIndex(globalIndex)];
+        }
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
@@ -1853,10 +1978,18 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     std::size_t EclipseGrid::fixupZCORN() {
+        const auto start = std::chrono::steady_clock::now();
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
 
-        return mapper.fixupZCORN( m_zcorn );
+        this->resetActiveGeometry();
+        const auto points_adjusted = mapper.fixupZCORN( m_zcorn );
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        OpmLog::debug(fmt::format("ZCORN fixup of {} cells: {} points adjusted in {:.3f} s",
+                                  this->getCartesianSize(), points_adjusted, elapsed.count()));
+
+        return points_adjusted;
     }
 
     const std::vector<double>& EclipseGrid::getZCORN( ) const {
@@ -2281,7 +2414,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         this->m_global_to_active.resize(global_size);
         std::iota(this->m_global_to_active.begin(), this->m_global_to_active.end(), 0);
         this->m_active_to_global = this->m_global_to_active;
-        this->active_volume = std::nullopt;
+        this->resetActiveGeometry();
     }
 
     void EclipseGrid::resetACTNUM(const int* actnum) {
@@ -2309,7 +2442,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
                 }
             }
-            this->active_volume = std::nullopt;
+            this->resetActiveGeometry();
         }
     }
 
@@ -2402,63 +2535,85 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return index(i,j,k,c);
     }
 
+    /*
+      The corner depths of different pillar corner columns, i.e. the same
+      corner c of the cells (i,j,k) for all k, are independent of each
+      other. The checks and the fixup therefore run in parallel over the
+      columns, visiting the cells of each column top down in the same order
+      as a serial pass; the result does not depend on the number of
+      threads.
+    */
     bool ZcornMapper::validZCORN( const std::vector<double>& zcorn) const {
-        int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
-        for (std::size_t j=0; j < this->dims[1]; j++)
-            for (std::size_t i=0; i < this->dims[0]; i++)
-                for (std::size_t c=0; c < 4; c++)
-                    for (std::size_t k=0; k < this->dims[2]; k++) {
-                        /* Between cells */
-                        if (k > 0) {
-                            std::size_t index1 = this->index(i,j,k-1,c+4);
-                            std::size_t index2 = this->index(i,j,k,c);
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0)
-                                return false;
-                        }
+        const int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
+        const auto num_columns = static_cast<std::int64_t>(this->dims[0] * this->dims[1] * 4);
+        bool valid = true;
+
+#pragma omp parallel for schedule(static) reduction(&&:valid)
+        for (std::int64_t column = 0; column < num_columns; ++column) {
+            const std::size_t c = column % 4;
+            const std::size_t cell = column / 4;
+            const std::size_t i = cell % this->dims[0];
+            const std::size_t j = cell / this->dims[0];
+
+            for (std::size_t k=0; (k < this->dims[2]) && valid; k++) {
+                /* Between cells */
+                if (k > 0) {
+                    std::size_t index1 = this->index(i,j,k-1,c+4);
+                    std::size_t index2 = this->index(i,j,k,c);
+                    if ((zcorn[index2] - zcorn[index1]) * sign < 0)
+                        valid = false;
+                }
 
-                        /* In cell */
-                        {
-                            std::size_t index1 = this->index(i,j,k,c);
-                            std::size_t index2 = this->index(i,j,k,c+4);
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0)
-                                return false;
-                        }
-                    }
+                /* In cell */
+                {
+                    std::size_t index1 = this->index(i,j,k,c);
+                    std::size_t index2 = this->index(i,j,k,c+4);
+                    if ((zcorn[index2] - zcorn[index1]) * sign < 0)
+                        valid = false;
+                }
+            }
+        }
 
-        return true;
+        return valid;
     }
 
 
     std::size_t ZcornMapper::fixupZCORN( std::vector<double>& zcorn) {
-        int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
+        const int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
+        const auto num_columns = static_cast<std::int64_t>(this->dims[0] * this->dims[1] * 4);
         std::size_t cells_adjusted = 0;
 
-        for (std::size_t k=0; k < this->dims[2]; k++)
-            for (std::size_t j=0; j < this->dims[1]; j++)
-                for (std::size_t i=0; i < this->dims[0]; i++)
-                    for (std::size_t c=0; c < 4; c++) {
-                        /* Cell to cell */
-                        if (k > 0) {
-                            std::size_t index1 = this->index(i,j,k-1,c+4);
-                            std::size_t index2 = this->index(i,j,k,c);
-
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
-                                cells_adjusted++;
-                            }
-                        }
+#pragma omp parallel for schedule(static) reduction(+:cells_adjusted)
+        for (std::int64_t column = 0; column < num_columns; ++column) {
+            const std::size_t c = column % 4;
+            const std::size_t cell = column / 4;
+            const std::size_t i = cell % this->dims[0];
+            const std::size_t j = cell / this->dims[0];
+
+            for (std::size_t k=0; k < this->dims[2]; k++) {
+                /* Cell to cell */
+                if (k > 0) {
+                    std::size_t index1 = this->index(i,j,k-1,c+4);
+                    std::size_t index2 = this->index(i,j,k,c);
+
+                    if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
+                        zcorn[index2] = zcorn[index1];
+                        cells_adjusted++;
+                    }
+                }
 
-                        /* Cell internal */
-                        {
-                            std::size_t index1 = this->index(i,j,k,c);
-                            std::size_t index2 = this->index(i,j,k,c+4);
+                /* Cell internal */
+                {
+                    std::size_t index1 = this->index(i,j,k,c);
+                    std::size_t index2 = this->index(i,j,k,c+4);
 
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
-                                cells_adjusted++;
-                            }
-                        }
+                    if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
+                        zcorn[index2] = zcorn[index1];
+                        cells_adjusted++;
                     }
+                }
+            }
+        }
         return cells_adjusted;
     }
 
@@ -2530,6 +2685,7 @@ namespace Opm {
     {
         m_coord = coord;
         m_zcorn = zcorn;
+        this->resetActiveGeometry();
     }
 
     void EclipseGridLGR::init_father_global()
@@ -194,7 +194,18 @@ namespace Opm {
         std::array<double, 3> getCellCenter(size_t i,size_t j, size_t k) const;
         std::array<double, 3> getCellCenter(size_t globalIndex) const;
         std::array<double, 3> getCornerPos(size_t i,size_t j, size_t k, size_t corner_index) const;
+        /// Volumes of the active cells. Unless computeActiveGeometry() has
+        /// stored them, they are computed on first use and kept until the
+        /// active cells or the corner point data change.
         const std::vector<double>& activeVolume() const;
+
+        /// Compute the volume, center and depth of all active cells in one
+        /// sweep over the grid and keep them.  Until the active cells or the
+        /// corner point data change, getCellVolume(), getCellCenter(),
+        /// getCellDepth() and activeVolume() answer active cells from the
+        /// stored values instead of computing them cell by cell.  The
+        /// stored values take about 40 bytes per active cell.
+        void computeActiveGeometry();
         double getCellVolume(size_t globalIndex) const;
         double getCellVolume(size_t i , size_t j , size_t k) const;
         double getCellThickness(size_t globalIndex) const;
@@ -295,6 +306,23 @@ namespace Opm {
         mutable std::optional<std::vector<double>> m_input_zcorn;
         mutable std::optional<std::vector<double>> m_input_coord;
 
+        // Volume, center and geometric depth of the active cells, stored by
+        // computeActiveGeometry() and reset when the geometry or the active
+        // cells change.
+        struct ActiveGeometry {
+            std::vector<double> volume;
+            std::vector<double> depth;
+            std::vector<std::array<double,3>> center;
+        };
+        std::optional<ActiveGeometry> active_geometry;
+
+        // Active cell volumes computed on first use by activeVolume() when
+        // the geometry is not stored. The pointer is loaded and published
+        // atomically, so concurrent const callers are safe.
+        mutable std::shared_ptr<const std::vector<double>> active_volume;
+
+        void resetActiveGeometry();
+
     private:
         std::vector<double> m_minpvVector;
         MinpvMode m_minpvMode;
@@ -308,7 +336,7 @@ namespace Opm {
         PinchMode m_pinchGapMode;
         double    m_pinchMaxEmptyGap;
         bool lgr_grid = false;
-        mutable std::optional<std::vector<double>> active_volume;
+
 
         bool m_circle = false;
         size_t zcorn_fixed = 0;
@@ -335,6 +363,8 @@ namespace Opm {
         void propagateParentIndicesToLGRChildren(int);
         void updateNumericalAquiferCells(const Deck&);
         double computeCellGeometricDepth(size_t globalIndex) const;
+        ActiveGeometry sweepActiveGeometry(bool volume_only) const;
+        bool hasActiveGeometry(size_t globalIndex) const;
 
         void initGridFromEGridFile(Opm::EclIO::EclFile& egridfile,
                                    const std::string& fileName);
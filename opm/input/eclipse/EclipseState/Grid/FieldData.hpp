@@ -28,10 +28,13 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -40,8 +43,251 @@ namespace Opm {
 
 namespace Opm::Fieldprops {
 
-    template <typename T>
-    static void compress(std::vector<T>&          data,
+    /*
+      Value status of the elements of a property array, packed with four
+      elements per byte. The status of a property with N elements then takes
+      N/4 bytes instead of N bytes, which matters for large models with many
+      properties. Mutable element access goes through a proxy reference;
+      concurrent writes to elements sharing a byte are not safe.
+
+      This replaces the std::vector<value::status> previously used for
+      FieldData::value_status. Code using that member as a vector keeps
+      working through size(), operator[], begin()/end() and the conversions
+      from and to std::vector<value::status>; since the elements are not
+      addressable there is no data(), and code which needs contiguous
+      storage must convert with to_vector().
+    */
+    class PackedStatus
+    {
+    public:
+        class reference
+        {
+        public:
+            reference(std::uint8_t& byte, const unsigned shift)
+                : byte_(byte)
+                , shift_(shift)
+            {}
+
+            reference(const reference&) = default;
+
+            operator value::status() const
+            {
+                return static_cast<value::status>((this->byte_ >> this->shift_) & mask);
+            }
+
+            reference& operator=(const value::status status)
+            {
+                this->byte_ = static_cast<std::uint8_t>
+                    ((this->byte_ & ~(mask << this->shift_)) |
+                     (static_cast<unsigned>(status) << this->shift_));
+                return *this;
+            }
+
+            reference& operator=(const reference& other)
+            {
+                return *this = static_cast<value::status>(other);
+            }
+
+        private:
+            std::uint8_t& byte_;
+            unsigned shift_;
+        };
+
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = value::status;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const value::status*;
+            using reference = value::status;
+
+            const_iterator(const PackedStatus& status, const std::size_t index)
+                : status_(&status)
+                , index_(index)
+            {}
+
+            value::status operator*() const
+            {
+                return (*this->status_)[this->index_];
+            }
+
+            const_iterator& operator++()
+            {
+                ++this->index_;
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                auto prev = *this;
+                ++this->index_;
+                return prev;
+            }
+
+            bool operator==(const const_iterator& other) const
+            {
+                return (this->status_ == other.status_)
+                    && (this->index_ == other.index_);
+            }
+
+            bool operator!=(const const_iterator& other) const
+            {
+                return ! (*this == other);
+            }
+
+        private:
+            const PackedStatus* status_;
+            std::size_t index_;
+        };
+
+        PackedStatus() = default;
+
+        PackedStatus(const std::size_t size, const value::status status)
+        {
+            this->assign(size, status);
+        }
+
+        PackedStatus(const std::vector<value::status>& status)
+        {
+            this->assign(status.size(), value::status::uninitialized);
+            for (std::size_t index = 0; index < status.size(); ++index) {
+                (*this)[index] = status[index];
+            }
+        }
+
+        std::vector<value::status> to_vector() const
+        {
+            return { this->begin(), this->end() };
+        }
+
+        operator std::vector<value::status>() const
+        {
+            return this->to_vector();
+        }
+
+        const_iterator begin() const
+        {
+            return { *this, 0 };
+        }
+
+        const_iterator end() const
+        {
+            return { *this, this->size_ };
+        }
+
+        std::size_t size() const
+        {
+            return this->size_;
+        }
+
+        bool empty() const
+        {
+            return this->size_ == 0;
+        }
+
+        value::status operator[](const std::size_t index) const
+        {
+            return static_cast<value::status>
+                ((this->bytes_[index / per_byte] >> shift(index)) & mask);
+        }
+
+        reference operator[](const std::size_t index)
+        {
+            return { this->bytes_[index / per_byte], shift(index) };
+        }
+
+        void assign(const std::size_t size, const value::status status)
+        {
+            this->size_ = size;
+            this->bytes_.assign((size + per_byte - 1) / per_byte, pattern(status));
+            this->clear_tail();
+        }
+
+        void fill(const value::status status)
+        {
+            std::fill(this->bytes_.begin(), this->bytes_.end(), pattern(status));
+            this->clear_tail();
+        }
+
+        // Sets the status of the elements [first, last).
+        void fill(std::size_t first, const std::size_t last, const value::status status)
+        {
+            for (; (first < last) && (first % per_byte != 0); ++first) {
+                (*this)[first] = status;
+            }
+
+            const auto whole_bytes = (last - first) / per_byte;
+            std::fill_n(this->bytes_.begin() + first / per_byte, whole_bytes, pattern(status));
+            first += whole_bytes * per_byte;
+
+            for (; first < last; ++first) {
+                (*this)[first] = status;
+            }
+        }
+
+        void resize(const std::size_t size)
+        {
+            this->bytes_.resize((size + per_byte - 1) / per_byte, std::uint8_t{0});
+            this->size_ = size;
+            this->clear_tail();
+        }
+
+        template <typename Predicate>
+        bool all_of(Predicate&& predicate) const
+        {
+            for (std::size_t index = 0; index < this->size_; ++index) {
+                if (! predicate((*this)[index])) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template <typename Predicate>
+        bool none_of(Predicate&& predicate) const
+        {
+            return this->all_of([&predicate](const value::status status)
+                                { return ! predicate(status); });
+        }
+
+        bool operator==(const PackedStatus& other) const
+        {
+            return (this->size_ == other.size_)
+                && (this->bytes_ == other.bytes_);
+        }
+
+    private:
+        static constexpr std::size_t per_byte = 4;
+        static constexpr unsigned mask = 0x3;
+
+        std::vector<std::uint8_t> bytes_{};
+        std::size_t size_{0};
+
+        static unsigned shift(const std::size_t index)
+        {
+            return 2 * static_cast<unsigned>(index % per_byte);
+        }
+
+        static std::uint8_t pattern(const value::status status)
+        {
+            const auto bits = static_cast<unsigned>(status);
+            return static_cast<std::uint8_t>(bits | (bits << 2) | (bits << 4) | (bits << 6));
+        }
+
+        // Unused bits of the last byte are kept zero, so that equal arrays
+        // compare equal bytewise.
+        void clear_tail()
+        {
+            if (const auto used = this->size_ % per_byte; used != 0) {
+                this->bytes_.back() &= static_cast<std::uint8_t>((1u << (2 * used)) - 1);
+            }
+        }
+    };
+
+    template <typename Container>
+    static void compress(Container&               data,
                          const std::vector<bool>& active_map,
                          const std::size_t values_per_cell = 1)
     {
@@ -71,10 +317,10 @@ namespace Opm::Fieldprops {
     struct FieldData
     {
         std::vector<T> data{};
-        std::vector<value::status> value_status{};
+        PackedStatus value_status{};
         keywords::keyword_info<T> kw_info{};
         std::optional<std::vector<T>> global_data{};
-        std::optional<std::vector<value::status>> global_value_status{std::nullopt};
+        std::optional<PackedStatus> global_value_status{std::nullopt};
         mutable bool all_set{false};
 
         bool operator==(const FieldData& other) const
@@ -130,21 +376,19 @@ namespace Opm::Fieldprops {
             // Object is "valid" if the 'value_status' of every element is
             // neither uninitialised nor empty.
             return this->all_set =
-                std::none_of(this->value_status.begin(), this->value_status.end(),
-                             [](const value::status& status)
-                             {
-                                 return (status == value::status::uninitialized)
-                                     || (status == value::status::empty_default);
-                             });
+                this->value_status.none_of([](const value::status status)
+                                           {
+                                               return (status == value::status::uninitialized)
+                                                   || (status == value::status::empty_default);
+                                           });
         }
 
         bool valid_default() const
         {
-            return std::all_of(this->value_status.begin(), this->value_status.end(),
-                               [](const value::status& status)
-                               {
-                                   return status == value::status::valid_default;
-                               });
+            return this->value_status.all_of([](const value::status status)
+                                             {
+                                                 return status == value::status::valid_default;
+                                             });
         }
 
         void compress(const std::vector<bool>& active_map)
@@ -163,17 +407,13 @@ namespace Opm::Fieldprops {
         void default_assign(T value)
         {
             std::fill(this->data.begin(), this->data.end(), value);
-            std::fill(this->value_status.begin(),
-                      this->value_status.end(),
-                      value::status::valid_default);
+            this->value_status.fill(value::status::valid_default);
 
             if (this->global_data) {
                 std::fill(this->global_data->begin(),
                           this->global_data->end(), value);
 
-                std::fill(this->global_value_status->begin(),
-                          this->global_value_status->end(),
-                          value::status::valid_default);
+                this->global_value_status->fill(value::status::valid_default);
             }
         }
 
@@ -187,8 +427,7 @@ namespace Opm::Fieldprops {
             }
 
             std::copy(src.begin(), src.end(), this->data.begin());
-            std::fill(this->value_status.begin(), this->value_status.end(),
-                      value::status::valid_default);
+            this->value_status.fill(value::status::valid_default);
         }
 
         void default_assign_global(const std::vector<T>& src)
@@ -207,8 +446,7 @@ namespace Opm::Fieldprops {
             }
 
             std::copy(src.begin(), src.end(), this->global_data->begin());
-            std::fill(this->global_value_status->begin(), this->global_value_status->end(),
-                      value::status::valid_default);
+            this->global_value_status->fill(value::status::valid_default);
         }
 
         void update_local_from_global(std::function<std::size_t(std::size_t)> local_to_global)
@@ -218,13 +456,11 @@ namespace Opm::Fieldprops {
                     "Cannot call update_local_from_gloabl on keyword with local storage"
                 };
             }
-            std::size_t i{};
-            auto current_status = this->value_status.begin();
-            for(auto current = this->data.begin(); current != this->data.end(); ++current, ++current_status, ++i)
+            for (std::size_t i = 0; i < this->data.size(); ++i)
             {
                 const auto& global = local_to_global(i);
-                *current = (*global_data)[global];
-                *current_status = (*global_value_status)[global];
+                this->data[i] = (*global_data)[global];
+                this->value_status[i] = std::as_const(*global_value_status)[global];
             }
         }
 
@@ -396,12 +396,62 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
     }
 }
 
+/*
+  Scalar edits of the cells in index_list. The loops are branch free, so
+  edits of contiguous cells can be vectorized, and large edits run in
+  parallel; the cells of an index list are distinct. Cells without a value
+  are left unchanged and counted.
+*/
+template <typename T, typename Op>
+std::size_t apply_scalar(std::vector<T>&                     data,
+                         const Fieldprops::PackedStatus&     value_status,
+                         const std::vector<Box::cell_index>& index_list,
+                         Op                                  op)
+{
+    const auto size = static_cast<std::ptrdiff_t>(index_list.size());
+    const bool parallel = index_list.size() > Operate::parallel_size;
+    std::size_t unInit = 0;
+
+    if (const auto range = Operate::contiguous_range(index_list); range.has_value()) {
+        T* values = data.data() + range->first;
+        const auto first = range->first;
+
+#pragma omp parallel for schedule(static) reduction(+:unInit) if(parallel)
+        for (std::ptrdiff_t i = 0; i < size; ++i) {
+            const bool has_value = value::has_value(value_status[first + i]);
+            values[i] = has_value ? op(values[i]) : values[i];
+            unInit += !has_value;
+        }
+
+        return unInit;
+    }
+
+#pragma omp parallel for schedule(static) reduction(+:unInit) if(parallel)
+    for (std::ptrdiff_t i = 0; i < size; ++i) {
+        const auto ix = index_list[i].active_index;
+        const bool has_value = value::has_value(value_status[ix]);
+        data[ix] = has_value ? op(data[ix]) : data[ix];
+        unInit += !has_value;
+    }
+
+    return unInit;
+}
+
 template <typename T>
 void assign_scalar(std::vector<T>&                     data,
-                   std::vector<value::status>&         value_status,
-                   const T                             value,
+                   Fieldprops::PackedStatus&           value_status,
+                   const std::vector<T>&               values,
                    const std::vector<Box::cell_index>& index_list)
 {
+    // Only the last of consecutive assignments is observable.
+    const auto value = values.back();
+
+    if (const auto range = Operate::contiguous_range(index_list); range.has_value()) {
+        std::fill(data.begin() + range->first, data.begin() + range->second, value);
+        value_status.fill(range->first, range->second, value::status::deck_value);
+        return;
+    }
+
     for (const auto& cell_index : index_list) {
         data[cell_index.active_index] = value;
         value_status[cell_index.active_index] = value::status::deck_value;
@@ -412,22 +462,18 @@ template <typename T>
 void multiply_scalar(const KeywordLocation&              loc,
                      std::string_view                    arrayName,
                      std::vector<T>&                     data,
-                     std::vector<value::status>&         value_status,
-                     const T                             value,
+                     Fieldprops::PackedStatus&           value_status,
+                     const std::vector<T>&               values,
                      const std::vector<Box::cell_index>& index_list)
 {
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] *= value;
-        }
-        else {
-            ++unInit;
-        }
-    }
+    const auto unInit = apply_scalar(data, value_status, index_list,
+                                     [&values](T x)
+                                     {
+                                         for (const auto value : values) {
+                                             x *= value;
+                                         }
+                                         return x;
+                                     });
 
     if (unInit > 0) {
         reject_undefined_operation(loc, unInit,
@@ -440,22 +486,18 @@ template <typename T>
 void add_scalar(const KeywordLocation&              loc,
                 std::string_view                    arrayName,
                 std::vector<T>&                     data,
-                std::vector<value::status>&         value_status,
-                const T                             value,
+                Fieldprops::PackedStatus&           value_status,
+                const std::vector<T>&               values,
                 const std::vector<Box::cell_index>& index_list)
 {
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] += value;
-        }
-        else {
-            ++unInit;
-        }
-    }
+    const auto unInit = apply_scalar(data, value_status, index_list,
+                                     [&values](T x)
+                                     {
+                                         for (const auto value : values) {
+                                             x += value;
+                                         }
+                                         return x;
+                                     });
 
     if (unInit > 0) {
         reject_undefined_operation(loc, unInit,
@@ -468,22 +510,18 @@ template <typename T>
 void min_value(const KeywordLocation&              loc,
                std::string_view                    arrayName,
                std::vector<T>&                     data,
-               std::vector<value::status>&         value_status,
-               const T                             value,
+               Fieldprops::PackedStatus&           value_status,
+               const std::vector<T>&               values,
                const std::vector<Box::cell_index>& index_list)
 {
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] = std::max(data[ix], value);
-        }
-        else {
-            ++unInit;
-        }
-    }
+    const auto unInit = apply_scalar(data, value_status, index_list,
+                                     [&values](T x)
+                                     {
+                                         for (const auto value : values) {
+                                             x = std::max(x, value);
+                                         }
+                                         return x;
+                                     });
 
     if (unInit > 0) {
         reject_undefined_operation(loc, unInit,
@@ -497,22 +535,18 @@ template <typename T>
 void max_value(const KeywordLocation&              loc,
                std::string_view                    arrayName,
                std::vector<T>&                     data,
-               std::vector<value::status>&         value_status,
-               const T                             value,
+               Fieldprops::PackedStatus&           value_status,
+               const std::vector<T>&               values,
                const std::vector<Box::cell_index>& index_list)
 {
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] = std::min(data[ix], value);
-        }
-        else {
-            ++unInit;
-        }
-    }
+    const auto unInit = apply_scalar(data, value_status, index_list,
+                                     [&values](T x)
+                                     {
+                                         for (const auto value : values) {
+                                             x = std::min(x, value);
+                                         }
+                                         return x;
+                                     });
 
     if (unInit > 0) {
         reject_undefined_operation(loc, unInit,
@@ -541,34 +575,36 @@ void update_global_from_local(Fieldprops::FieldData<T>& data,
     }
 }
 
+// Applies the operation op with each of the scalar values in turn, in a
+// single pass over the cells of index_list.
 template <typename T>
 void apply(const Fieldprops::ScalarOperation   op,
            const KeywordLocation&              loc,
            std::string_view                    arrayName,
            std::vector<T>&                     data,
-           std::vector<value::status>&         value_status,
-           const T                             scalar_value,
+           Fieldprops::PackedStatus&           value_status,
+           const std::vector<T>&               scalar_values,
            const std::vector<Box::cell_index>& index_list)
 {
     switch (op) {
     case Fieldprops::ScalarOperation::EQUAL:
-        assign_scalar(data, value_status, scalar_value, index_list);
+        assign_scalar(data, value_status, scalar_values, index_list);
         return;
 
     case Fieldprops::ScalarOperation::MUL:
-        multiply_scalar(loc, arrayName, data, value_status, scalar_value, index_list);
+        multiply_scalar(loc, arrayName, data, value_status, scalar_values, index_list);
         return;
 
     case Fieldprops::ScalarOperation::ADD:
-        add_scalar(loc, arrayName, data, value_status, scalar_value, index_list);
+        add_scalar(loc, arrayName, data, value_status, scalar_values, index_list);
         return;
 
     case Fieldprops::ScalarOperation::MIN:
-        min_value(loc, arrayName, data, value_status, scalar_value, index_list);
+        min_value(loc, arrayName, data, value_status, scalar_values, index_list);
         return;
 
     case Fieldprops::ScalarOperation::MAX:
-        max_value(loc, arrayName, data, value_status, scalar_value, index_list);
+        max_value(loc, arrayName, data, value_status, scalar_values, index_list);
         return;
     }
 
@@ -1401,36 +1437,32 @@ void FieldProps::operate(const DeckRecord&                   record,
 
     const auto alpha = this->get_alpha(func_name, target_array, record.getItem("PARAM1").get<double>(0));
     const auto beta  = this->get_beta(func_name, target_array, record.getItem("PARAM2").get<double>(0));
-    const auto func  = Operate::get(func_name, alpha, beta);
 
     auto& to_data = global? *target_data.global_data : target_data.data;
     auto& to_status = global? *target_data.global_value_status : target_data.value_status;
     const auto& from_data = global? *src_data.global_data : src_data.data;
     auto& from_status = global? *src_data.global_value_status : src_data.value_status;
 
+    // index_list holds global indices in the active_index member if
+    // global is true and global storage is used.
     for (const auto& cell_index : index_list) {
-        // This is the global index if global is true and global storage is used.
         const auto ix = cell_index.active_index;
 
-        if (value::has_value(from_status[ix])) {
-            if (!check_target || value::has_value(to_status[ix])) {
-                to_data[ix] = func(to_data[ix], from_data[ix]);
-                to_status[ix] = from_status[ix];
-            }
-            else {
-                throw std::invalid_argument {
-                    "Tried to use unset property value "
-                    "in OPERATE/OPERATER keyword"
-                };
-            }
-        }
-        else {
+        if (!value::has_value(from_status[ix]) ||
+            (check_target && !value::has_value(to_status[ix])))
+        {
             throw std::invalid_argument {
-                "Tried to use unset property value in "
-                "OPERATE/OPERATER keyword"
+                "Tried to use unset property value "
+                "in OPERATE/OPERATER keyword"
             };
         }
     }
+
+    Operate::apply(func_name, alpha, beta, to_data, from_data, index_list);
+
+    for (const auto& cell_index : index_list) {
+        to_status[cell_index.active_index] = from_status[cell_index.active_index];
+    }
 }
 
 void FieldProps::handle_operateR(const DeckKeyword& keyword)
@@ -1555,7 +1587,7 @@ void FieldProps::handle_region_operation(const DeckKeyword& keyword)
 
             apply(operation, keyword.location(), target_kw,
                   field_data.data, field_data.value_status,
-                  scalar_value, index_list);
+                  std::vector<double>{ scalar_value }, index_list);
 
             // Supporting region operations on global storage arrays would
             // require global storage for the *NUM region set arrays (i.e.,
@@ -1660,10 +1692,54 @@ void FieldProps::handle_operation(const Section      section,
 
     std::unordered_map<std::string, std::string> tran_fields;
 
+    // Consecutive records operating on the same array within the same box
+    // are collected and applied in a single pass over the box, applying
+    // the scalar values in record order.
+    auto pending_array = std::string {};
+    auto pending_extents = std::array<int, 6> {};
+    Fieldprops::FieldData<double>* pending_double = nullptr;
+    Fieldprops::FieldData<int>* pending_int = nullptr;
+    std::vector<double> double_values;
+    std::vector<int> int_values;
+
+    auto apply_pending = [&]()
+    {
+        if (pending_double != nullptr) {
+            apply(operation, keyword.location(), pending_array,
+                  pending_double->data, pending_double->value_status,
+                  double_values, box.index_list());
+
+            if (pending_double->global_data) {
+                apply(operation, keyword.location(), pending_array,
+                      *pending_double->global_data,
+                      *pending_double->global_value_status,
+                      double_values, box.global_index_list());
+            }
+        }
+
+        if (pending_int != nullptr) {
+            apply(operation, keyword.location(), pending_array,
+                  pending_int->data,
+                  pending_int->value_status,
+                  int_values, box.index_list());
+        }
+
+        pending_array.clear();
+        pending_double = nullptr;
+        pending_int = nullptr;
+        double_values.clear();
+        int_values.clear();
+    };
+
     for (const auto& record : keyword) {
         const auto target_kw = Fieldprops::keywords::
             get_keyword_from_alias(record.getItem(0).getTrimmedString(0));
 
+        const auto extents = box.extents(record);
+        if ((target_kw != pending_array) || (extents != pending_extents)) {
+            apply_pending();
+        }
+
         box.update(record);
 
         if (auto tran_iter = this->tran.find(target_kw);
@@ -1716,19 +1792,11 @@ void FieldProps::handle_operation(const Section      section,
             const auto scalar_value = this->
                 getSIValue(operation, target_kw, record.getItem(1).get<double>(0));
 
-            auto& field_data = this->init_get<double>
+            pending_double = &this->init_get<double>
                 (unique_name, kw_info, /* multiplier_in_edit =*/ editSect && kw_info.multiplier);
-
-            apply(operation, keyword.location(), target_kw,
-                  field_data.data, field_data.value_status,
-                  scalar_value, box.index_list());
-
-            if (field_data.global_data) {
-                apply(operation, keyword.location(), target_kw,
-                      *field_data.global_data,
-                      *field_data.global_value_status,
-                      scalar_value, box.global_index_list());
-            }
+            pending_array = target_kw;
+            pending_extents = extents;
+            double_values.push_back(scalar_value);
 
             continue;
         }
@@ -1745,12 +1813,10 @@ void FieldProps::handle_operation(const Section      section,
 
             const auto scalar_value = static_cast<int>(record.getItem(1).get<double>(0));
 
-            auto& field_data = this->init_get<int>(target_kw);
-
-            apply(operation, keyword.location(), target_kw,
-                  field_data.data,
-                  field_data.value_status,
-                  scalar_value, box.index_list());
+            pending_int = &this->init_get<int>(target_kw);
+            pending_array = target_kw;
+            pending_extents = extents;
+            int_values.push_back(scalar_value);
 
             continue;
         }
@@ -1761,6 +1827,8 @@ void FieldProps::handle_operation(const Section      section,
             keyword.location()
         };
     }
+
+    apply_pending();
 }
 
 void FieldProps::handle_COPY(const DeckKeyword& keyword,
@@ -34,6 +34,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <stdexcept>
 #include <string>
@@ -154,6 +155,8 @@ namespace Opm {
 
         this->template fillSearchMap<0>(m_records);
         this->template fillSearchMap<1>(m_records_same);
+
+        this->buildRegionPairTables();
     }
 
     template<int index>
@@ -212,6 +215,8 @@ namespace Opm {
         result.regions = {{"test3", {11}}};
         result.aquifer_cells = { std::size_t{17}, std::size_t{29} };
 
+        result.buildRegionPairTables();
+
         return result;
     }
 
@@ -237,6 +242,8 @@ namespace Opm {
         this->regions = data.regions;
         this->aquifer_cells = data.aquifer_cells;
 
+        this->buildRegionPairTables();
+
         return *this;
     }
 
@@ -281,22 +288,10 @@ namespace Opm {
         // multiplier value is the product of the values from each record.
         auto multiplier = 1.0;
 
-        if (this->m_searchMap.empty()) {
+        if (this->m_regionPairTables.empty()) {
             return multiplier;
         }
 
-        auto regPairFoundDifferent = [faceDir, this](const auto& regMap, const auto& regPairPos)
-        {
-            return (regPairPos != regMap.end())
-                && ((this->m_records[regPairPos->second].directions & faceDir) != 0);
-        };
-
-        auto regPairFoundSame = [faceDir, this](const auto& regMap, const auto& regPairPos)
-        {
-            return (regPairPos != regMap.end())
-                && ((this->m_records_same[regPairPos->second].directions & faceDir) != 0);
-        };
-
         auto ignoreMultiplierRecord =
             [is_adj = is_adjacent(this->gridDims, globalIndex1, globalIndex2),
              is_aqu = this->isAquNNC(globalIndex1, globalIndex2)]
@@ -313,39 +308,30 @@ namespace Opm {
                 || (is_aqu              && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
         };
 
+        const auto applyMultiplier = [faceDir, ignoreMultiplierRecord](const MULTREGTRecord& record)
+        {
+            return ((record.directions & faceDir) != 0)
+                && ((record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL) ||
+                    ! ignoreMultiplierRecord(record.nnc_behaviour));
+        };
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
-
-            auto regionId1 = region_data[globalIndex1];
-            auto regionId2 = region_data[globalIndex2];
-
-            if (regionId1 > regionId2) {
-                std::swap(regionId1, regionId2);
-            }
-
-            const auto applyMultiplier = [ignoreMultiplierRecord](const MULTREGTRecord& record)
-            {
-                return (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL) ||
-                ! ignoreMultiplierRecord(record.nnc_behaviour);
-            };
+        for (const auto& table : this->m_regionPairTables) {
+            const auto [slot1, slot2] = this->regionSlots(table, globalIndex1, globalIndex2);
 
-            multiplier = this->applyMultiplierDifferentRegion(regMaps,
+            multiplier = this->applyMultiplierDifferentRegion(table,
                                                               multiplier,
-                                                              regionId1,
-                                                              regionId2,
-                                                              applyMultiplier,
-                                                              regPairFoundDifferent);
+                                                              slot1,
+                                                              slot2,
+                                                              applyMultiplier);
             // same region. Note that a pair where both region indices are the same is special.
             // For connections between it and all other regions the multipliers
             // will not override otherwise explicitly specified (as pairs with
             // different ids) multipliers, but accumulated to these.
-            multiplier = this->applyMultiplierSameRegion(regMaps,
+            multiplier = this->applyMultiplierSameRegion(table,
                                                          multiplier,
-                                                         regionId1,
-                                                         regionId2,
-                                                         applyMultiplier,
-                                                         regPairFoundSame);
+                                                         slot1,
+                                                         slot2,
+                                                         applyMultiplier);
         }
 
         return multiplier;
@@ -360,7 +346,7 @@ namespace Opm {
         // multiplier value is the product of the values from each record.
         auto multiplier = 1.0;
 
-        if (this->m_searchMap.empty()) {
+        if (this->m_regionPairTables.empty()) {
             return multiplier;
         }
 
@@ -372,66 +358,115 @@ namespace Opm {
                 || (is_aqu && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
         };
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
-
-            auto regionId1 = region_data[globalCellIdx1];
-            auto regionId2 = region_data[globalCellIdx2];
-
-            if (regionId1> regionId2) {
-                std::swap(regionId1, regionId2);
-            }
-
-            const auto applyMultiplier = [ignoreMultiplierRecord](const auto& record){
-                return ! ignoreMultiplierRecord(record.nnc_behaviour);
-            };
+        // All entries match no matter what FaceDir says.
+        const auto applyMultiplier = [ignoreMultiplierRecord](const MULTREGTRecord& record)
+        {
+            return ! ignoreMultiplierRecord(record.nnc_behaviour);
+        };
 
-            const auto regPairFound = [](const auto& regMap, const auto& regPairPos)
-            {
-                // all entries match no matter what FaceDir says.
-                return (regPairPos != regMap.end());
-            };
+        for (const auto& table : this->m_regionPairTables) {
+            const auto [slot1, slot2] = this->regionSlots(table, globalCellIdx1, globalCellIdx2);
 
-            multiplier = this->applyMultiplierSameRegion(regMaps,
+            multiplier = this->applyMultiplierSameRegion(table,
                                                          multiplier,
-                                                         regionId1,
-                                                         regionId2,
-                                                         applyMultiplier,
-                                                         regPairFound);
+                                                         slot1,
+                                                         slot2,
+                                                         applyMultiplier);
             // same region. Note that a pair where both region indices are the same is special.
             // For connections between it and all other regions the multipliers
             // will not override otherwise explicitly specified (as pairs with
             // different ids) multipliers, but accumulated to these.
-            multiplier = this->applyMultiplierDifferentRegion(regMaps,
+            multiplier = this->applyMultiplierDifferentRegion(table,
                                                               multiplier,
-                                                              regionId1,
-                                                              regionId2,
-                                                              applyMultiplier,
-                                                              regPairFound);
+                                                              slot1,
+                                                              slot2,
+                                                              applyMultiplier);
         }
 
         return multiplier;
     }
 
-    template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
-                                                           double multiplier,
-                                                           std::size_t regionId1,
-                                                           std::size_t regionId2,
-                                                           const ApplyDecision& applyMultiplier,
-                                                           const RegPairFound& regPairFound) const
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliers(const std::vector<std::size_t>&      globalCellIdx1,
+                                          const std::vector<std::size_t>&      globalCellIdx2,
+                                          const std::vector<FaceDir::DirEnum>& faceDir) const
     {
-        const auto& myMap = std::get<0>(regMaps);
-        decltype(myMap.begin()) regPairPos;
+        if ((globalCellIdx2.size() != globalCellIdx1.size()) ||
+            (faceDir.size() != globalCellIdx1.size()))
+        {
+            throw std::invalid_argument {
+                "Cell index and face direction arrays of "
+                "MULTREGT connection batch must have the same size"
+            };
+        }
+
+        std::vector<double> multipliers(globalCellIdx1.size(), 1.0);
+        if (this->m_regionPairTables.empty()) {
+            return multipliers;
+        }
+
+        // Region arrays are looked up, and missing ones reported, before
+        // entering the parallel loop.
+        for (const auto& table : this->m_regionPairTables) {
+            if (table.region_data == nullptr) {
+                this->regions.at(table.region_name);
+            }
+        }
+
+#pragma omp parallel for schedule(static)
+        for (std::int64_t conn = 0; conn < static_cast<std::int64_t>(multipliers.size()); ++conn) {
+            multipliers[conn] = this->getRegionMultiplier(globalCellIdx1[conn],
+                                                          globalCellIdx2[conn],
+                                                          faceDir[conn]);
+        }
 
-        regPairPos = myMap.find({ regionId1, regionId2 });
+        return multipliers;
+    }
 
-        if (!regPairFound(myMap, regPairPos)) {
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliersNNC(const std::vector<std::size_t>& globalCellIdx1,
+                                             const std::vector<std::size_t>& globalCellIdx2) const
+    {
+        if (globalCellIdx2.size() != globalCellIdx1.size()) {
+            throw std::invalid_argument {
+                "Cell index arrays of MULTREGT NNC batch must have the same size"
+            };
+        }
+
+        std::vector<double> multipliers(globalCellIdx1.size(), 1.0);
+        if (this->m_regionPairTables.empty()) {
+            return multipliers;
+        }
+
+        for (const auto& table : this->m_regionPairTables) {
+            if (table.region_data == nullptr) {
+                this->regions.at(table.region_name);
+            }
+        }
+
+#pragma omp parallel for schedule(static)
+        for (std::int64_t conn = 0; conn < static_cast<std::int64_t>(multipliers.size()); ++conn) {
+            multipliers[conn] = this->getRegionMultiplierNNC(globalCellIdx1[conn],
+                                                             globalCellIdx2[conn]);
+        }
+
+        return multipliers;
+    }
+
+    template<typename ApplyDecision>
+    double MULTREGTScanner::applyMultiplierDifferentRegion(const RegionPairTable& table,
+                                                           double multiplier,
+                                                           const int slot1,
+                                                           const int slot2,
+                                                           const ApplyDecision& applyMultiplier) const
+    {
+        const auto recordIx = table.differentRecord(slot1, slot2);
+        if (recordIx < 0) {
             // Pair not found.
             return multiplier;
         }
-        const auto& record = this->m_records[regPairPos->second];
 
+        const auto& record = this->m_records[recordIx];
         if (applyMultiplier(record)) {
             multiplier *= record.trans_mult;
         }
@@ -440,45 +475,162 @@ namespace Opm {
     }
 
 
-    template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+    template<typename ApplyDecision>
+    double MULTREGTScanner::applyMultiplierSameRegion(const RegionPairTable& table,
                                                       double multiplier,
-                                                      std::size_t regionId1,
-                                                      std::size_t regionId2,
-                                                      const ApplyDecision& applyMultiplier,
-                                                      const RegPairFound& regPairFound) const
+                                                      const int slot1,
+                                                      const int slot2,
+                                                      const ApplyDecision& applyMultiplier) const
     {
-        const auto& myMap = std::get<1>(regMaps);
-        decltype(myMap.begin()) regPairPos;
-
         // search for entry where the two region ids are the same
         // where one of those is a region of ours.
-        regPairPos = myMap.find({ regionId1, regionId1 });
-
-        if (regPairFound(myMap, regPairPos)) {
-            const auto& record = this->m_records_same[regPairPos->second];
+        if ((slot1 >= 0) && (table.same[slot1] >= 0)) {
+            const auto& record = this->m_records_same[table.same[slot1]];
 
             if (applyMultiplier(record)) {
                 multiplier *= record.trans_mult;
             }
         }
-        if (regionId1 != regionId2)
+        if ((slot1 != slot2) && (slot2 >= 0) && (table.same[slot2] >= 0))
         {
             // also try to apply other region multiplier.
-            regPairPos = myMap.find({ regionId2, regionId2 });
+            const auto& record = this->m_records_same[table.same[slot2]];
 
-            if (regPairFound(myMap, regPairPos)) {
-                const auto& record = this->m_records_same[regPairPos->second];
-
-                if (applyMultiplier(record)) {
-                    multiplier *= record.trans_mult;
-                }
+            if (applyMultiplier(record)) {
+                multiplier *= record.trans_mult;
             }
         }
 
         return multiplier;
     }
 
+    std::pair<int,int>
+    MULTREGTScanner::regionSlots(const RegionPairTable& table,
+                                 const std::size_t      globalCellIdx1,
+                                 const std::size_t      globalCellIdx2) const
+    {
+        const auto& region_data = (table.region_data != nullptr)
+            ? *table.region_data
+            : this->regions.at(table.region_name);
+
+        auto regionId1 = region_data[globalCellIdx1];
+        auto regionId2 = region_data[globalCellIdx2];
+
+        if (regionId1 > regionId2) {
+            std::swap(regionId1, regionId2);
+        }
+
+        return { table.slotOf(regionId1), table.slotOf(regionId2) };
+    }
+
+    int MULTREGTScanner::RegionPairTable::slotOf(const int regionId) const
+    {
+        if (this->slot.empty()) {
+            const auto pos = this->sparse_slot.find(regionId);
+            return (pos != this->sparse_slot.end()) ? pos->second : -1;
+        }
+
+        const auto offset = static_cast<std::int64_t>(regionId) - this->min_region;
+
+        return ((offset >= 0) && (offset < static_cast<std::int64_t>(this->slot.size())))
+            ? this->slot[offset] : -1;
+    }
+
+    int MULTREGTScanner::RegionPairTable::differentRecord(const int slot1, const int slot2) const
+    {
+        if ((slot1 < 0) || (slot2 < 0)) {
+            return -1;
+        }
+
+        if (! this->different.empty()) {
+            return this->different[slot1*this->num_slots + slot2];
+        }
+
+        const auto key = (static_cast<std::uint64_t>(slot1) << 32) | static_cast<std::uint64_t>(slot2);
+        auto pos = std::lower_bound(this->sparse_different.begin(), this->sparse_different.end(), key,
+                                    [](const auto& entry, const std::uint64_t k) { return entry.first < k; });
+
+        return ((pos != this->sparse_different.end()) && (pos->first == key)) ? pos->second : -1;
+    }
+
+    // Compiles the search maps into one RegionPairTable per region set,
+    // in the iteration order of m_searchMap so that the product of the
+    // multipliers is formed in the same order as before.
+    void MULTREGTScanner::buildRegionPairTables()
+    {
+        // Region sets with more region IDs in the records than this use
+        // the sparse representation of the pairs of different regions, and
+        // region sets whose IDs span more values than this look up their
+        // slots in a hash map.
+        constexpr std::size_t max_dense_slots = 2048;
+
+        this->m_regionPairTables.clear();
+
+        for (const auto& [regName, regMaps] : this->m_searchMap) {
+            auto& table = this->m_regionPairTables.emplace_back();
+            table.region_name = regName;
+
+            if (auto regPos = this->regions.find(regName); regPos != this->regions.end()) {
+                table.region_data = &regPos->second;
+            }
+
+            std::vector<int> ids;
+            for (const auto& regMap : regMaps) {
+                for (const auto& [regPair, recordIx] : regMap) {
+                    ids.push_back(regPair.first);
+                    ids.push_back(regPair.second);
+                }
+            }
+
+            ids = unique(std::move(ids));
+            table.num_slots = ids.size();
+            if (ids.empty()) {
+                continue;
+            }
+
+            table.min_region = ids.front();
+            const auto span = static_cast<std::size_t>
+                (static_cast<std::int64_t>(ids.back()) - ids.front()) + 1;
+            if (span <= max_dense_slots) {
+                table.slot.assign(span, -1);
+                for (std::size_t slot = 0; slot < ids.size(); ++slot) {
+                    table.slot[ids[slot] - table.min_region] = static_cast<int>(slot);
+                }
+            }
+            else {
+                table.sparse_slot.reserve(ids.size());
+                for (std::size_t slot = 0; slot < ids.size(); ++slot) {
+                    table.sparse_slot.emplace(ids[slot], static_cast<int>(slot));
+                }
+            }
+
+            table.same.assign(table.num_slots, -1);
+            for (const auto& [regPair, recordIx] : std::get<1>(regMaps)) {
+                table.same[table.slotOf(regPair.first)] = static_cast<int>(recordIx);
+            }
+
+            const auto& differentMap = std::get<0>(regMaps);
+            if (table.num_slots <= max_dense_slots) {
+                table.different.assign(table.num_slots * table.num_slots, -1);
+                for (const auto& [regPair, recordIx] : differentMap) {
+                    const auto slot1 = table.slotOf(regPair.first);
+                    const auto slot2 = table.slotOf(regPair.second);
+                    table.different[slot1*table.num_slots + slot2] = static_cast<int>(recordIx);
+                }
+            }
+            else {
+                // Slots increase with the region IDs, so the map order is
+                // also the order of the keys.
+                table.sparse_different.reserve(differentMap.size());
+                for (const auto& [regPair, recordIx] : differentMap) {
+                    const auto key = (static_cast<std::uint64_t>(table.slotOf(regPair.first)) << 32)
+                        | static_cast<std::uint64_t>(table.slotOf(regPair.second));
+                    table.sparse_different.emplace_back(key, static_cast<int>(recordIx));
+                }
+            }
+        }
+    }
+
     void MULTREGTScanner::addKeyword(const DeckKeyword& deckKeyword)
     {
         using Kw = ParserKeywords::MULTREGT;
@@ -25,9 +25,11 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -109,6 +111,29 @@ namespace Opm {
         double getRegionMultiplierNNC(std::size_t globalCellIdx1,
                                       std::size_t globalCellIdx2) const;
 
+        /// Region multipliers of a batch of connections between
+        /// neighbouring cells.
+        ///
+        /// \param[in] globalCellIdx1 Global index of the first cell of each
+        ///    connection.
+        /// \param[in] globalCellIdx2 Global index of the second cell of each
+        ///    connection.
+        /// \param[in] faceDir Direction of each connection, seen from the
+        ///    first cell.
+        ///
+        /// \return Multiplier of each connection, same as
+        ///    getRegionMultiplier().
+        std::vector<double>
+        getRegionMultipliers(const std::vector<std::size_t>&      globalCellIdx1,
+                             const std::vector<std::size_t>&      globalCellIdx2,
+                             const std::vector<FaceDir::DirEnum>& faceDir) const;
+
+        /// Region multipliers of a batch of non-neighbouring connections,
+        /// same as getRegionMultiplierNNC() for each connection.
+        std::vector<double>
+        getRegionMultipliersNNC(const std::vector<std::size_t>& globalCellIdx1,
+                                const std::vector<std::size_t>& globalCellIdx2) const;
+
         template <class Serializer>
         void serializeOp(Serializer& serializer)
         {
@@ -120,6 +145,10 @@ namespace Opm {
 
             serializer(regions);
             serializer(aquifer_cells);
+
+            if (!serializer.isSerializing()) {
+                this->buildRegionPairTables();
+            }
         }
 
     private:
@@ -130,22 +159,46 @@ namespace Opm {
             std::vector<MULTREGTRecord>::size_type
         >;
 
+        /// \brief Dense lookup table of the records of one region set.
+        ///
+        /// Every region ID used in a record of the set is given a slot, in
+        /// increasing order of the IDs.  The table holds the index of the
+        /// record, if any, for every pair of slots (records between
+        /// different regions) and for every slot (records with the same
+        /// source and target region).  Region sets with very many region
+        /// IDs in the records use a sorted list of pairs instead of the
+        /// dense pair table, and region sets whose IDs span a wide range
+        /// look up the slots in a hash map instead of a dense array.
+        struct RegionPairTable
+        {
+            std::string region_name{};
+            const std::vector<int>* region_data{nullptr};
+
+            std::vector<int> slot{};
+            std::unordered_map<int, int> sparse_slot{};
+            int min_region{0};
+            std::size_t num_slots{0};
+
+            std::vector<int> different{};
+            std::vector<std::pair<std::uint64_t, int>> sparse_different{};
+            std::vector<int> same{};
+
+            int slotOf(int regionId) const;
+            int differentRecord(int slot1, int slot2) const;
+        };
+
         /// \brief Apply regionMultiplier from entries where source and target region differ
         ///
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
-        /// \param regionId1 Id of egion for first cell
-        /// \param regionId Id of regions for the second cell (not less than regionId1!)
+        /// \param table Lookup table of the region set (FLUXNUM or else)
+        /// \param slot1 Table slot of the region for the first cell
+        /// \param slot2 Table slot of the region for the second cell
         /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
-        template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+        template<typename ApplyDecision>
+        double applyMultiplierDifferentRegion(const RegionPairTable& table,
                                               double multiplier,
-                                              std::size_t regionId1,
-                                              std::size_t regionId2,
-                                              const ApplyDecision& applyMultiplier,
-                                              const RegPairFound& regPairFound) const;
+                                              int slot1,
+                                              int slot2,
+                                              const ApplyDecision& applyMultiplier) const;
 
         /// \brief Apply region multipliers from entries with same source and target region
         ///
@@ -153,20 +206,25 @@ namespace Opm {
         /// For connections between it and all other regions the multipliers
         /// will not override otherwise explicitly specified (as pairs with
         /// different ids) multipliers, but accumulated to these.
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
-        /// \param regionId1 Id of egion for first cell
-        /// \param regionId Id of regions for the second cell (not less than regionId1!)
+        /// \param table Lookup table of the region set (FLUXNUM or else)
+        /// \param slot1 Table slot of the region for the first cell
+        ///        (region ID not greater than for the second cell!)
+        /// \param slot2 Table slot of the region for the second cell
         /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
-        template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+        template<typename ApplyDecision>
+        double applyMultiplierSameRegion(const RegionPairTable& table,
                                          double multiplier,
-                                         std::size_t regionId1,
-                                         std::size_t regionId2,
-                                         const ApplyDecision& applyMultiplier,
-                                         const RegPairFound& regPairFound) const;
+                                         int slot1,
+                                         int slot2,
+                                         const ApplyDecision& applyMultiplier) const;
+
+        /// \brief Table slots of the regions of two cells, ordered by region ID.
+        std::pair<int,int> regionSlots(const RegionPairTable& table,
+                                       std::size_t globalCellIdx1,
+                                       std::size_t globalCellIdx2) const;
+
+        void buildRegionPairTables();
+
         template<int index>
         void fillSearchMap(const std::vector<MULTREGTRecord>& records);
 
@@ -187,6 +245,9 @@ namespace Opm {
         std::map<std::string, std::vector<int>> regions{};
         std::vector<std::size_t> aquifer_cells{};
 
+        // Compiled from m_searchMap, one table per region set.
+        std::vector<RegionPairTable> m_regionPairTables{};
+
         void addKeyword(const DeckKeyword& deckKeyword);
 
         bool isAquNNC(std::size_t globalCellIdx1, std::size_t globalCellIdx2) const;
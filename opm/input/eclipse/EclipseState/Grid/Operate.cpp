@@ -16,7 +16,9 @@
   OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include <cmath>
+#include <cstddef>
 #include <map>
+#include <stdexcept>
 #include <string>
 
 #include "Operate.hpp"
@@ -106,29 +108,82 @@ namespace {
     }
 
     using func4 = decltype(&MULTA);
-    static const std::map<std::string, func4> operations = {{"MULTA", &MULTA},
-                                                            {"POLY", &POLY},
-                                                            {"SLOG", &SLOG},
-                                                            {"LOG10", &LOG10},
-                                                            {"LOGE", &LOGE},
-                                                            {"INV", &INV},
-                                                            {"MULTX", &MULTX},
-                                                            {"ADDX", &ADDX},
-                                                            {"COPY", &COPY},
-                                                            {"MAXLIM", &MAXLIM},
-                                                            {"MINLIM", &MINLIM},
-                                                            {"MULTP", &MULTP},
-                                                            {"ABS", &ABS},
-                                                            {"MULTIPLY", &MULTIPLY}};
+
+    /*
+      The OPERATE function is a template argument of the loop, so it is
+      inlined and the loop over contiguous cells can be vectorized.
+    */
+    template <func4 Func>
+    void apply_function(double alpha, double beta,
+                        std::vector<double>& R, const std::vector<double>& X,
+                        const std::vector<Box::cell_index>& index_list)
+    {
+        const auto size = static_cast<std::ptrdiff_t>(index_list.size());
+        const bool parallel = index_list.size() > parallel_size;
+
+        if (const auto range = contiguous_range(index_list); range.has_value()) {
+            double* r = R.data() + range->first;
+            const double* x = X.data() + range->first;
+
+#pragma omp parallel for schedule(static) if(parallel)
+            for (std::ptrdiff_t i = 0; i < size; ++i) {
+                r[i] = Func(r[i], x[i], alpha, beta);
+            }
+
+            return;
+        }
+
+#pragma omp parallel for schedule(static) if(parallel)
+        for (std::ptrdiff_t i = 0; i < size; ++i) {
+            const auto ix = index_list[i].active_index;
+            R[ix] = Func(R[ix], X[ix], alpha, beta);
+        }
+    }
+
+    using apply_func = decltype(&apply_function<&MULTA>);
+    static const std::map<std::string, apply_func> operations = {{"MULTA", &apply_function<&MULTA>},
+                                                                 {"POLY", &apply_function<&POLY>},
+                                                                 {"SLOG", &apply_function<&SLOG>},
+                                                                 {"LOG10", &apply_function<&LOG10>},
+                                                                 {"LOGE", &apply_function<&LOGE>},
+                                                                 {"INV", &apply_function<&INV>},
+                                                                 {"MULTX", &apply_function<&MULTX>},
+                                                                 {"ADDX", &apply_function<&ADDX>},
+                                                                 {"COPY", &apply_function<&COPY>},
+                                                                 {"MAXLIM", &apply_function<&MAXLIM>},
+                                                                 {"MINLIM", &apply_function<&MINLIM>},
+                                                                 {"MULTP", &apply_function<&MULTP>},
+                                                                 {"ABS", &apply_function<&ABS>},
+                                                                 {"MULTIPLY", &apply_function<&MULTIPLY>}};
 }
 
-function get(const std::string& func, double alpha, double beta) {
-    auto inner_func = operations.at(func);
+std::optional<std::pair<std::size_t, std::size_t>>
+contiguous_range(const std::vector<Box::cell_index>& index_list)
+{
+    if (index_list.empty()) {
+        return {};
+    }
+
+    const auto first = index_list.front().active_index;
+    const auto last = index_list.back().active_index;
+    if (last - first + 1 != index_list.size()) {
+        return {};
+    }
+
+    for (std::size_t i = 0; i < index_list.size(); ++i) {
+        if (index_list[i].active_index != first + i) {
+            return {};
+        }
+    }
+
+    return std::make_pair(first, last + 1);
+}
 
-    return [alpha, beta, inner_func](double R, double X)
-           {
-               return inner_func(R,X,alpha,beta);
-           };
+void apply(const std::string& func, double alpha, double beta,
+           std::vector<double>& R, const std::vector<double>& X,
+           const std::vector<Box::cell_index>& index_list)
+{
+    operations.at(func)(alpha, beta, R, X, index_list);
 }
 
 }
@@ -18,16 +18,32 @@
 #ifndef OPERATE_HPP
 #define OPERATE_HPP
 
-#include <functional>
+#include <opm/input/eclipse/EclipseState/Grid/Box.hpp>
 
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace Opm {
 namespace Operate {
 
-//using operate_fptr = decltype(&MULTA);
-using function = std::function<double(double,double)>;
-
-function get(const std::string& func, double alpha, double beta);
+/// Cells in index_list are processed in parallel when there are more
+/// than this many of them.
+constexpr std::size_t parallel_size = 1 << 15;
+
+/// The active indices [first, last) if the cells of index_list are the
+/// consecutive cells first, first + 1, ..., last - 1; the kernels then
+/// address the arrays directly instead of through the index list.
+std::optional<std::pair<std::size_t, std::size_t>>
+contiguous_range(const std::vector<Box::cell_index>& index_list);
+
+/// Applies the OPERATE function func with parameters alpha and beta,
+/// R[ix] = func(R[ix], X[ix]), to the active indices ix of index_list.
+void apply(const std::string& func, double alpha, double beta,
+           std::vector<double>& R, const std::vector<double>& X,
+           const std::vector<Box::cell_index>& index_list);
 
 }
 }
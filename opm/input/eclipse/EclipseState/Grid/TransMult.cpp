@@ -40,6 +40,42 @@
 #include <opm/output/data/Cells.hpp>
 #include <opm/output/data/Solution.hpp>
 
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+    // Index 0, 1, 2 of the I, J, K axis of a face direction and whether
+    // the direction is the positive one along that axis.
+    std::pair<int,bool> faceAxis(const Opm::FaceDir::DirEnum faceDir)
+    {
+        switch (faceDir) {
+        case Opm::FaceDir::XPlus:  return { 0, true };
+        case Opm::FaceDir::XMinus: return { 0, false };
+        case Opm::FaceDir::YPlus:  return { 1, true };
+        case Opm::FaceDir::YMinus: return { 1, false };
+        case Opm::FaceDir::ZPlus:  return { 2, true };
+        case Opm::FaceDir::ZMinus: return { 2, false };
+        default:
+            throw std::invalid_argument("Invalid face direction");
+        }
+    }
+
+    Opm::FaceDir::DirEnum opposite(const Opm::FaceDir::DirEnum faceDir)
+    {
+        switch (faceDir) {
+        case Opm::FaceDir::XPlus:  return Opm::FaceDir::XMinus;
+        case Opm::FaceDir::XMinus: return Opm::FaceDir::XPlus;
+        case Opm::FaceDir::YPlus:  return Opm::FaceDir::YMinus;
+        case Opm::FaceDir::YMinus: return Opm::FaceDir::YPlus;
+        case Opm::FaceDir::ZPlus:  return Opm::FaceDir::ZMinus;
+        case Opm::FaceDir::ZMinus: return Opm::FaceDir::ZPlus;
+        default:
+            throw std::invalid_argument("Invalid face direction");
+        }
+    }
+
+} // Anonymous namespace
 
 namespace Opm {
 
@@ -74,6 +110,8 @@ namespace Opm {
         result.m_trans = {{FaceDir::YPlus, {4.0, 5.0}}};
         result.m_names = {{FaceDir::ZPlus, "test1"}};
         result.m_multregtScanner = MULTREGTScanner::serializationTestObject();
+        result.m_face_mult = {{ std::vector<double>(6, 0.5), std::vector<double>(6, 1.0),
+                                std::vector<double>(6, 2.0) }};
 
         return result;
     }
@@ -137,6 +175,7 @@ namespace Opm {
 
     void TransMult::applyMULT(const std::vector<double>& srcData, FaceDir::DirEnum faceDir)
     {
+        this->clearFaceMultipliers();
         auto& dstProp = this->getDirectionProperty(faceDir);
         for (size_t i = 0; i < srcData.size(); ++i)
             dstProp[i] *= srcData[i];
@@ -144,6 +183,7 @@ namespace Opm {
 
 
     void TransMult::applyMULTFLT(const Fault& fault) {
+        this->clearFaceMultipliers();
         double transMult = fault.getTransMult();
 
         for( const auto& face : fault ) {
@@ -164,9 +204,136 @@ namespace Opm {
     }
 
     void TransMult::applyNumericalAquifer(const std::vector<std::size_t>& aquifer_cells) {
+        this->clearFaceMultipliers();
         m_multregtScanner.applyNumericalAquifer(aquifer_cells);
     }
 
+    void TransMult::clearFaceMultipliers() {
+        for (auto& face_mult : this->m_face_mult) {
+            face_mult.clear();
+        }
+    }
+
+    bool TransMult::finalized() const {
+        return !this->m_face_mult[0].empty();
+    }
+
+    void TransMult::finalize() {
+        const std::array<std::size_t,3> dims {{ this->m_nx, this->m_ny, this->m_nz }};
+        const std::array<std::size_t,3> stride {{ 1, this->m_nx, this->m_nx * this->m_ny }};
+        const std::array<FaceDir::DirEnum,3> plus {{ FaceDir::XPlus, FaceDir::YPlus, FaceDir::ZPlus }};
+        const std::size_t global_size = this->m_nx * this->m_ny * this->m_nz;
+
+        if (global_size == 0) {
+            return;
+        }
+
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            const auto minus = opposite(plus[axis]);
+            const auto* plus_mult = this->hasDirectionProperty(plus[axis]) ? &this->m_trans.at(plus[axis]) : nullptr;
+            const auto* minus_mult = this->hasDirectionProperty(minus) ? &this->m_trans.at(minus) : nullptr;
+
+            // The faces are visited one layer at a time, so the MULTREGT
+            // multipliers can be looked up in batches.
+            const std::size_t layer_size = this->m_nx * this->m_ny;
+            std::vector<std::size_t> cells1, cells2;
+            std::vector<FaceDir::DirEnum> faceDirs;
+
+            auto& face_mult = this->m_face_mult[axis];
+            face_mult.assign(global_size, 1.0);
+
+            for (std::size_t layer = 0; layer < this->m_nz; ++layer) {
+                cells1.clear();
+                cells2.clear();
+                for (std::size_t g = layer * layer_size; g < (layer + 1) * layer_size; ++g) {
+                    const std::size_t index = (g / stride[axis]) % dims[axis];
+                    if (index + 1 < dims[axis]) {
+                        cells1.push_back(g);
+                        cells2.push_back(g + stride[axis]);
+                    }
+                }
+
+                faceDirs.assign(cells1.size(), plus[axis]);
+                const auto region_mult = this->m_multregtScanner.getRegionMultipliers(cells1, cells2, faceDirs);
+
+#pragma omp parallel for schedule(static)
+                for (std::int64_t face = 0; face < static_cast<std::int64_t>(cells1.size()); ++face) {
+                    const auto g1 = cells1[face];
+                    const auto g2 = cells2[face];
+                    const double mult1 = (plus_mult != nullptr) ? (*plus_mult)[g1] : 1.0;
+                    const double mult2 = (minus_mult != nullptr) ? (*minus_mult)[g2] : 1.0;
+
+                    face_mult[g1] = mult1 * mult2 * region_mult[face];
+                }
+            }
+        }
+    }
+
+    void TransMult::applyMultipliers(const std::vector<std::size_t>&      globalCellIndex1,
+                                     const std::vector<std::size_t>&      globalCellIndex2,
+                                     const std::vector<FaceDir::DirEnum>& faceDir,
+                                     std::vector<double>&                 trans) const
+    {
+        const auto num_conn = globalCellIndex1.size();
+        if ((globalCellIndex2.size() != num_conn) ||
+            (faceDir.size() != num_conn) ||
+            (trans.size() != num_conn))
+        {
+            throw std::invalid_argument {
+                "Cell index, face direction and transmissibility arrays "
+                "of connection batch must have the same size"
+            };
+        }
+
+        const std::array<std::size_t,3> dims {{ this->m_nx, this->m_ny, this->m_nz }};
+        const std::array<std::size_t,3> stride {{ 1, this->m_nx, this->m_nx * this->m_ny }};
+        const std::size_t global_size = this->m_nx * this->m_ny * this->m_nz;
+
+        for (std::size_t conn = 0; conn < num_conn; ++conn) {
+            faceAxis(faceDir[conn]);
+            if ((globalCellIndex1[conn] >= global_size) || (globalCellIndex2[conn] >= global_size)) {
+                throw std::invalid_argument("Invalid global index");
+            }
+        }
+
+        // Connections between Cartesian neighbours take the combined face
+        // multiplier, the others are collected and handled below.
+        std::vector<char> combined(num_conn, 0);
+        if (this->finalized()) {
+#pragma omp parallel for schedule(static)
+            for (std::int64_t conn = 0; conn < static_cast<std::int64_t>(num_conn); ++conn) {
+                const auto [axis, positive] = faceAxis(faceDir[conn]);
+                const auto lower = positive ? globalCellIndex1[conn] : globalCellIndex2[conn];
+                const auto upper = positive ? globalCellIndex2[conn] : globalCellIndex1[conn];
+
+                if ((upper == lower + stride[axis]) &&
+                    ((lower / stride[axis]) % dims[axis] + 1 < dims[axis]))
+                {
+                    trans[conn] *= this->m_face_mult[axis][lower];
+                    combined[conn] = 1;
+                }
+            }
+        }
+
+        std::vector<std::size_t> conns, cells1, cells2;
+        std::vector<FaceDir::DirEnum> faceDirs;
+        for (std::size_t conn = 0; conn < num_conn; ++conn) {
+            if (! combined[conn]) {
+                conns.push_back(conn);
+                cells1.push_back(globalCellIndex1[conn]);
+                cells2.push_back(globalCellIndex2[conn]);
+                faceDirs.push_back(faceDir[conn]);
+            }
+        }
+
+        const auto region_mult = this->m_multregtScanner.getRegionMultipliers(cells1, cells2, faceDirs);
+        for (std::size_t i = 0; i < conns.size(); ++i) {
+            trans[conns[i]] *= this->getMultiplier__(cells1[i], faceDirs[i])
+                * this->getMultiplier__(cells2[i], opposite(faceDirs[i]))
+                * region_mult[i];
+        }
+    }
+
     data::Solution TransMult::convertToSimProps(std::size_t grid_size,
                                                 bool include_all_multminus) const {
         data::Solution solution{false}; // not in si to prevent conversions
@@ -192,7 +359,8 @@ namespace Opm {
                this->m_nz == data.m_nz &&
                this->m_trans == data.m_trans &&
                this->m_names == data.m_names &&
-               this->m_multregtScanner == data.m_multregtScanner;
+               this->m_multregtScanner == data.m_multregtScanner &&
+               this->m_face_mult == data.m_face_mult;
     }
 
 }
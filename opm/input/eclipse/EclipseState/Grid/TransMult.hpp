@@ -30,9 +30,11 @@
 #define OPM_PARSER_TRANSMULT_HPP
 
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
@@ -66,6 +68,35 @@ namespace Opm {
         void applyMULTFLT(const Fault& fault);
         void applyNumericalAquifer(const std::vector<std::size_t>& aquifer_cells);
 
+        /// \brief Combine all multipliers of the faces between neighbouring cells
+        ///
+        /// Computes, for every cell and each of the I, J and K directions,
+        /// the product of the MULT* (including fault) multipliers on both
+        /// sides of the face to the next cell and the MULTREGT multiplier
+        /// of the connection.  The combined values are used by
+        /// applyMultipliers() until the multipliers are modified again.
+        void finalize();
+
+        /// \brief Whether or not finalize() has been called since the last modification.
+        bool finalized() const;
+
+        /// \brief Apply the multipliers to the transmissibilities of a batch of connections
+        ///
+        /// The transmissibility of each connection is multiplied by
+        /// getMultiplier(cell1, faceDir) * getMultiplier(cell2, opposite
+        /// of faceDir) * getRegionMultiplier(cell1, cell2, faceDir).
+        /// Connections between Cartesian neighbours use the combined face
+        /// multipliers when finalized.
+        ///
+        /// \param[in] globalCellIndex1 Global index of the first cell of each connection.
+        /// \param[in] globalCellIndex2 Global index of the second cell of each connection.
+        /// \param[in] faceDir Direction of each connection, seen from the first cell.
+        /// \param[in,out] trans Transmissibility of each connection.
+        void applyMultipliers(const std::vector<std::size_t>&      globalCellIndex1,
+                              const std::vector<std::size_t>&      globalCellIndex2,
+                              const std::vector<FaceDir::DirEnum>& faceDir,
+                              std::vector<double>&                 trans) const;
+
         /// \brief Creates a solution object with all multipliers for output
         /// \param active_cells If the model has no multipliers then this number is used as the size of
         ///                     the array (containing 1) that are constructed in this case.
@@ -85,6 +116,7 @@ namespace Opm {
             serializer(m_trans);
             serializer(m_names);
             serializer(m_multregtScanner);
+            serializer(m_face_mult);
         }
 
     private:
@@ -98,6 +130,13 @@ namespace Opm {
         std::map<FaceDir::DirEnum , std::vector<double> > m_trans;
         std::map<FaceDir::DirEnum , std::string> m_names;
         MULTREGTScanner m_multregtScanner;
+
+        // Combined multipliers of the faces between each cell and its
+        // neighbour in the positive I, J and K directions, see finalize().
+        // Empty when not finalized.
+        std::array<std::vector<double>,3> m_face_mult;
+
+        void clearFaceMultipliers();
     };
 
 }
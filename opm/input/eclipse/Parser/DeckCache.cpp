@@ -0,0 +1,346 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+#include <opm/common/utility/StableHash.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Parser/ParserKeyword.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/R.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/T.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <set>
+#include <string_view>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#include <unistd.h>
+
+namespace {
+
+    /*
+      Layout of a cache entry file:
+
+        magic
+        blob: (Key, dependencies, keyword hashes)
+        blob: number of keywords
+        blob: keyword       (repeated)
+
+      where the keyword hashes are the raw text hashes of the dependency
+      keywords in the file, which the parser picks up when the entry is
+      loaded.
+
+      where every blob is written as its size and hash followed by the
+      serialized bytes. The hash guards against truncated or partially
+      written entries, which are then ignored. The version in the magic
+      must be bumped whenever the layout or the serialized types change.
+    */
+    constexpr std::array<char, 8> magic = { 'O', 'P', 'M', 'D', 'K', 'C', '0', '3' };
+
+    // Name of a deck keyword and the raw text hash of its last instance,
+    // if any, when the include file was opened.
+    using Dependencies = std::vector<std::pair<std::string, std::optional<std::uint64_t>>>;
+    using KeywordHashes = Opm::DeckCache::KeywordHashes;
+
+    const Opm::Serialization::MemPacker mem_packer{};
+
+    class BufferSerializer : public Opm::Serializer<Opm::Serialization::MemPacker> {
+    public:
+        BufferSerializer()
+            : Opm::Serializer<Opm::Serialization::MemPacker>(mem_packer)
+        {}
+
+        std::vector<char>& buffer()
+        {
+            return this->m_buffer;
+        }
+    };
+
+    std::uint64_t buffer_hash(const std::vector<char>& buffer)
+    {
+        return Opm::stableHash({ buffer.data(), buffer.size() });
+    }
+
+    void write_blob(std::ofstream& os, const std::vector<char>& buffer)
+    {
+        const std::uint64_t size = buffer.size();
+        const std::uint64_t hash = buffer_hash(buffer);
+        os.write(reinterpret_cast<const char*>(&size), sizeof size);
+        os.write(reinterpret_cast<const char*>(&hash), sizeof hash);
+        os.write(buffer.data(), buffer.size());
+    }
+
+    bool read_blob(std::ifstream& is, std::vector<char>& buffer)
+    {
+        std::uint64_t size = 0;
+        std::uint64_t hash = 0;
+        is.read(reinterpret_cast<char*>(&size), sizeof size);
+        is.read(reinterpret_cast<char*>(&hash), sizeof hash);
+        if (!is)
+            return false;
+
+        buffer.resize(size);
+        is.read(buffer.data(), size);
+        return is && (buffer_hash(buffer) == hash);
+    }
+
+    std::optional<std::uint64_t> keyword_hash(const KeywordHashes& hashes, const std::string& name)
+    {
+        const auto hash = hashes.find(name);
+        if (hash == hashes.end())
+            return {};
+
+        return hash->second;
+    }
+
+    void add_dependencies(const Opm::ParserKeyword& parserKeyword, std::set<std::string>& names)
+    {
+        names.insert(parserKeyword.requiredKeywords().begin(), parserKeyword.requiredKeywords().end());
+        names.insert(parserKeyword.prohibitedKeywords().begin(), parserKeyword.prohibitedKeywords().end());
+
+        if (parserKeyword.getSizeType() == Opm::OTHER_KEYWORD_IN_DECK)
+            names.insert(parserKeyword.getKeywordSize().keyword());
+
+        if (parserKeyword.getSizeType() == Opm::SPECIAL_CASE_ROCK) {
+            names.insert(Opm::ParserKeywords::TABDIMS::keywordName);
+            names.insert(Opm::ParserKeywords::ROCKOPTS::keywordName);
+        }
+    }
+
+    std::set<std::string> keyword_dependencies(const Opm::Parser& parser,
+                                               const Opm::Deck& deck,
+                                               std::size_t begin,
+                                               std::size_t end)
+    {
+        std::set<std::string> names;
+        for (std::size_t index = begin; index < end; ++index) {
+            const auto& name = deck[index].name();
+            if (!parser.isRecognizedKeyword(name))
+                continue;
+
+            add_dependencies(parser.getParserKeywordFromDeckName(name), names);
+        }
+
+        return names;
+    }
+
+}
+
+namespace Opm {
+
+    bool DeckCache::Key::operator==(const Key& other) const
+    {
+        return (this->path == other.path)
+            && (this->content_size == other.content_size)
+            && (this->content_hash == other.content_hash)
+            && (this->definition_hash == other.definition_hash)
+            && (this->context_hash == other.context_hash)
+            && (this->active_units == other.active_units)
+            && (this->default_units == other.default_units);
+    }
+
+    DeckCache::DeckCache(const std::filesystem::path& directory, const Parser& parser)
+        : m_directory(directory)
+    {
+        for (const auto& name : parser.getAllDeckNames()) {
+            if (parser.isRecognizedKeyword(name))
+                add_dependencies(parser.getParserKeywordFromDeckName(name), this->m_dependency_keywords);
+        }
+    }
+
+    const std::set<std::string>& DeckCache::dependencyKeywords() const
+    {
+        return this->m_dependency_keywords;
+    }
+
+    DeckCache::Key DeckCache::makeKey(const std::filesystem::path& include_file,
+                                      std::uint64_t content_size,
+                                      std::uint64_t content_hash,
+                                      std::uint64_t definition_hash,
+                                      const ParseContext& parseContext,
+                                      const Deck& deck)
+    {
+        Key key;
+        key.path = include_file.generic_string();
+        key.content_size = content_size;
+        key.content_hash = content_hash;
+        key.definition_hash = definition_hash;
+        key.context_hash = parseContext.hash();
+        key.active_units = deck.getActiveUnitSystem().getName();
+        key.default_units = deck.getDefaultUnitSystem().getName();
+        return key;
+    }
+
+    std::filesystem::path DeckCache::entryPath(const std::string& include_file) const
+    {
+        // Entry files are named by a hash of the path; the full path is
+        // stored in the entry's key and compared on load.
+        return this->m_directory / fmt::format("{:016x}.deckcache", stableHash(include_file));
+    }
+
+    std::optional<DeckCache::Entry> DeckCache::load(const Key& key, const KeywordHashes& keyword_hashes) const
+    {
+        std::ifstream is(this->entryPath(key.path), std::ios::binary);
+        if (!is)
+            return {};
+
+        std::array<char, magic.size()> file_magic{};
+        is.read(file_magic.data(), file_magic.size());
+        if (!is || (file_magic != magic))
+            return {};
+
+        try {
+            BufferSerializer ser;
+            if (!read_blob(is, ser.buffer()))
+                return {};
+
+            Entry entry;
+            Key entry_key;
+            Dependencies dependencies;
+            ser.unpack(entry_key, dependencies, entry.keyword_hashes);
+            if (!(entry_key == key))
+                return {};
+
+            for (const auto& [name, hash] : dependencies) {
+                if (keyword_hash(keyword_hashes, name) != hash)
+                    return {};
+            }
+
+            std::size_t num_keywords = 0;
+            if (!read_blob(is, ser.buffer()))
+                return {};
+            ser.unpack(num_keywords);
+
+            entry.keywords.resize(num_keywords);
+            for (auto& keyword : entry.keywords) {
+                if (!read_blob(is, ser.buffer()))
+                    return {};
+                ser.unpack(keyword);
+            }
+
+            return entry;
+        }
+        catch (const std::exception& e) {
+            OpmLog::warning(fmt::format("Ignoring invalid deck cache entry for {}: {}", key.path, e.what()));
+            return {};
+        }
+    }
+
+    void DeckCache::store(const Key& key,
+                          const Parser& parser,
+                          const Deck& deck,
+                          std::size_t begin,
+                          std::size_t end,
+                          const KeywordHashes& hashes_at_open,
+                          const KeywordHashes& hashes_at_close) const
+    {
+        /*
+          Files with a dependency which the parser does not track, e.g. of a
+          keyword matched by a wildcard, can not be validated on load and are
+          not stored.
+        */
+        Dependencies dependencies;
+        for (const auto& name : keyword_dependencies(parser, deck, begin, end)) {
+            if (this->m_dependency_keywords.count(name) == 0)
+                return;
+
+            dependencies.emplace_back(name, keyword_hash(hashes_at_open, name));
+        }
+
+        KeywordHashes keyword_hashes;
+        for (std::size_t index = begin; index < end; ++index) {
+            const auto& name = deck[index].name();
+            const auto hash = hashes_at_close.find(name);
+            if (hash != hashes_at_close.end())
+                keyword_hashes.insert(*hash);
+        }
+
+        /*
+          The entry is written to a temporary file which is renamed on
+          completion, so concurrent runs never see a partially written entry
+          under the final name. The temporary file is created by mkstemp(),
+          hence its name is unique also among runs sharing the cache
+          directory.
+        */
+        std::error_code ec;
+        std::filesystem::create_directories(this->m_directory, ec);
+
+        const auto entry = this->entryPath(key.path);
+        std::string tmp_name = entry.string() + ".XXXXXX";
+        const int fd = ::mkstemp(tmp_name.data());
+        if (fd < 0)
+            return;
+
+        ::close(fd);
+        const std::filesystem::path tmp_entry(tmp_name);
+
+        // mkstemp() restricts the file to its owner; entries should be as
+        // readable as any other file in the cache directory.
+        using std::filesystem::perms;
+        std::filesystem::permissions(tmp_entry,
+                                     perms::owner_read | perms::owner_write |
+                                     perms::group_read | perms::others_read, ec);
+
+        {
+            std::ofstream os(tmp_entry, std::ios::binary);
+            if (!os) {
+                std::filesystem::remove(tmp_entry, ec);
+                return;
+            }
+
+            os.write(magic.data(), magic.size());
+
+            BufferSerializer ser;
+            ser.pack(key, dependencies, keyword_hashes);
+            write_blob(os, ser.buffer());
+
+            ser.pack(end - begin);
+            write_blob(os, ser.buffer());
+
+            for (std::size_t index = begin; index < end; ++index) {
+                ser.pack(deck[index]);
+                write_blob(os, ser.buffer());
+            }
+
+            if (!os) {
+                os.close();
+                std::filesystem::remove(tmp_entry, ec);
+                return;
+            }
+        }
+
+        std::filesystem::rename(tmp_entry, entry, ec);
+        if (ec)
+            std::filesystem::remove(tmp_entry, ec);
+    }
+
+}
@@ -0,0 +1,150 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DECK_CACHE_HPP
+#define OPM_DECK_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+    class Deck;
+    class DeckKeyword;
+    class ParseContext;
+    class Parser;
+
+    /*
+      On disk cache of the keywords parsed from INCLUDE files. The cache
+      holds one entry per include file, stored in a binary file in the
+      cache directory with the Serializer/MemPacker machinery.
+
+      An entry is only used if all of the following are unchanged since it
+      was stored:
+
+        1. The canonical path of the include file, i.e. after PATHS aliases
+           have been resolved, and the size and hash of its content.
+
+        2. The keyword definitions of the parser, see
+           Parser::definitionHash().
+
+        3. The ParseContext, see ParseContext::hash().
+
+        4. The active and default unit systems when the file is opened.
+
+        5. The content of the last instance of every deck keyword the
+           parsing of the file depended on; that is the keywords which give
+           the size of the keywords in the file (e.g. TABDIMS for SWOF) and
+           the required and prohibited keywords of the keywords in the file.
+           The content is compared by a hash of the keyword's raw text,
+           which the parser maintains as it goes, see KeywordHashes.
+
+      The parser only stores include files which did not include other
+      files, did not define PATHS aliases and which were parsed without any
+      errors or warnings.
+
+      All hashes are stable across builds, see stableHash(). Entries written
+      by an incompatible version of the cache format are ignored.
+    */
+    class DeckCache {
+    public:
+        struct Key {
+            std::string path;
+            std::uint64_t content_size = 0;
+            std::uint64_t content_hash = 0;
+            std::uint64_t definition_hash = 0;
+            std::uint64_t context_hash = 0;
+            std::string active_units;
+            std::string default_units;
+
+            bool operator==(const Key& other) const;
+
+            template<class Serializer>
+            void serializeOp(Serializer& serializer)
+            {
+                serializer(path);
+                serializer(content_size);
+                serializer(content_hash);
+                serializer(definition_hash);
+                serializer(context_hash);
+                serializer(active_units);
+                serializer(default_units);
+            }
+        };
+
+        /// Hash of the raw text of the last instance of each keyword in
+        /// the deck which the parsing of other keywords may depend on, see
+        /// dependencyKeywords().
+        using KeywordHashes = std::unordered_map<std::string, std::uint64_t>;
+
+        /// The keywords of a cache entry, along with the raw text hashes of
+        /// the dependency keywords among them.
+        struct Entry {
+            std::vector<DeckKeyword> keywords;
+            KeywordHashes keyword_hashes;
+        };
+
+        DeckCache(const std::filesystem::path& directory, const Parser& parser);
+
+        /// Names of all keywords of the parser which the parsing of other
+        /// keywords may depend on, i.e. size keywords and required and
+        /// prohibited keywords.
+        const std::set<std::string>& dependencyKeywords() const;
+
+        static Key makeKey(const std::filesystem::path& include_file,
+                           std::uint64_t content_size,
+                           std::uint64_t content_hash,
+                           std::uint64_t definition_hash,
+                           const ParseContext& parseContext,
+                           const Deck& deck);
+
+        /// The keywords of the include file identified by key, if they are
+        /// in the cache and the entry is still valid for the deck keywords
+        /// with the given hashes.
+        std::optional<Entry> load(const Key& key, const KeywordHashes& keyword_hashes) const;
+
+        /// Stores the deck keywords [begin, end), i.e. the keywords parsed
+        /// from the include file identified by key. The keyword hashes are
+        /// those of the deck when the file was opened and closed
+        /// respectively. Failure to write the cache entry is not an error.
+        void store(const Key& key,
+                   const Parser& parser,
+                   const Deck& deck,
+                   std::size_t begin,
+                   std::size_t end,
+                   const KeywordHashes& hashes_at_open,
+                   const KeywordHashes& hashes_at_close) const;
+
+    private:
+        std::filesystem::path entryPath(const std::string& include_file) const;
+
+        std::filesystem::path m_directory;
+        std::set<std::string> m_dependency_keywords;
+    };
+
+}
+
+#endif
@@ -35,6 +35,9 @@ public:
 
     explicit operator bool() const { return !this->error_list.empty(); }
 
+    // Total number of errors and warnings recorded.
+    std::size_t size() const { return this->error_list.size() + this->warning_list.size(); }
+
     /*
       Observe that this destructor has somewhat special semantics. If there
       are errors in the error list it will print all warnings and errors on
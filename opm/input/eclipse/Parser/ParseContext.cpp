@@ -28,6 +28,7 @@
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/shmatch.hpp>
+#include <opm/common/utility/StableHash.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
 namespace Opm {
@@ -348,6 +349,17 @@ namespace Opm {
         return false;
     }
 
+    std::uint64_t ParseContext::hash() const {
+        std::string state = this->m_input_skip_mode + ";";
+        for (const auto& [key, action] : this->m_errorContexts)
+            state += key + "=" + std::to_string(static_cast<int>(action)) + ";";
+
+        for (const auto& keyword : this->ignore_keywords)
+            state += keyword + ";";
+
+        return stableHash(state);
+    }
+
     const std::string ParseContext::PARSE_EXTRA_RECORDS = "PARSE_EXTRA_RECORDS";
     const std::string ParseContext::PARSE_UNKNOWN_KEYWORD = "PARSE_UNKNOWN_KEYWORD";
     const std::string ParseContext::PARSE_RANDOM_TEXT = "PARSE_RANDOM_TEXT";
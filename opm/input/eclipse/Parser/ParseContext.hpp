@@ -21,6 +21,7 @@
 #ifndef OPM_PARSE_CONTEXT_HPP
 #define OPM_PARSE_CONTEXT_HPP
 
+#include <cstdint>
 #include <map>
 #include <optional>
 #include <set>
@@ -380,6 +381,13 @@ class KeywordLocation;
         void setInputSkipMode(const std::string& skip_mode);
         bool isActiveSkipKeyword(const std::string& deck_name) const;
 
+        /*
+          Hash of the error actions, the ignored keywords and the input skip
+          mode; used to invalidate cached parse results when the context
+          changes. The hash is stable across builds and platforms.
+        */
+        std::uint64_t hash() const;
+
     private:
         void initDefault();
         void initEnv();
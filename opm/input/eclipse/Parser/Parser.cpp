@@ -23,6 +23,7 @@
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
@@ -49,6 +50,7 @@
 
 #include <opm/json/JsonObject.hpp>
 
+#include <opm/common/utility/StableHash.hpp>
 #include <opm/common/utility/String.hpp>
 
 #include "raw/RawConsts.hpp"
@@ -59,11 +61,17 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <iostream>
 #include <iterator>
 #include <optional>
+#include <sstream>
 #include <stack>
 #include <stdexcept>
 #include <string>
@@ -428,8 +436,109 @@ inline bool isTerminatedRecordString(const std::string_view& line) {
     return (line.back() == RawConsts::slash);
 }
 
+/*
+  Returns the file names of the INCLUDE keywords found in the cleaned
+  input, in the order they appear. This is only a cheap textual scan used
+  to read include files ahead of the parser; the actual INCLUDE handling
+  is done by parseState().
+*/
+inline std::vector<std::string> include_file_names( std::string_view input ) {
+    std::vector<std::string> names;
+    std::string_view line;
+
+    while( getline( input, line ) ) {
+        if( line.size() < RawConsts::include.size() || make_deck_name( line ) != RawConsts::include )
+            continue;
+
+        while( getline( input, line ) && line.empty() ) {}
+
+        auto name = trim( del_after_first_slash( line ) );
+        if( name.empty() )
+            continue;
+
+        if( name.front() == RawConsts::quote ) {
+            name.remove_prefix( 1 );
+            name = name.substr( 0, name.find( RawConsts::quote ) );
+        } else
+            name = name.substr( 0, name.find_first_of( " \t" ) );
+
+        if( !name.empty() )
+            names.emplace_back( name );
+    }
+
+    return names;
+}
+
+}
+
+/*
+  Reads the complete input file into a buffer with a trailing newline. The
+  file is read C-style for performance reasons, as streams are slow.
+  Returns an empty optional if the file can not be opened.
+*/
+std::optional<std::string> read_input_file( const std::filesystem::path& inputFile ) {
+    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
+    std::unique_ptr<std::FILE, decltype(closer)> ufp{
+        std::fopen( inputFile.generic_string().c_str(), "rb" ),
+        closer
+    };
+
+    if( !ufp )
+        return {};
+
+    auto* fp = ufp.get();
+    std::string buffer;
+    std::fseek( fp, 0, SEEK_END );
+    buffer.resize( std::ftell( fp ) + 1 );
+    std::rewind( fp );
+    const auto readc = std::fread( &buffer[ 0 ], 1, buffer.size() - 1, fp );
+    buffer.back() = '\n';
+
+    if( std::ferror( fp ) || readc != buffer.size() - 1 )
+        throw std::runtime_error( "Error when reading input file '"
+                                  + inputFile.string() + "'" );
+
+    return buffer;
 }
 
+/*
+  A cleaned input file, along with the names of the files it includes and
+  the size and, for the deck cache, the hash of the raw file content.
+*/
+struct LoadedFile {
+    std::optional<std::string> input;
+    std::vector<std::string> includes;
+    std::uint64_t content_size = 0;
+    std::uint64_t content_hash = 0;
+};
+
+LoadedFile load_input_file( const std::vector<std::pair<std::string, std::string>>& code_keywords,
+                            const std::filesystem::path& inputFile,
+                            const bool hash_content ) {
+    LoadedFile loaded;
+    auto buffer = read_input_file( inputFile );
+    if( !buffer.has_value() )
+        return loaded;
+
+    loaded.content_size = buffer.value().size();
+    if( hash_content )
+        loaded.content_hash = stableHash( buffer.value() );
+    loaded.input = str::clean( code_keywords, buffer.value() );
+    loaded.includes = str::include_file_names( loaded.input.value() );
+    return loaded;
+}
+
+/*
+  An include file which will be stored in the deck cache when it is closed,
+  unless it turns out to be unsuitable for caching.
+*/
+struct CacheRecord {
+    DeckCache::Key key;
+    std::size_t first_keyword;
+    std::size_t num_messages;
+    DeckCache::KeywordHashes keyword_hashes;
+};
+
 struct file {
     file( std::filesystem::path p, const std::string& in ) :
         input( in ), path( p )
@@ -438,6 +547,7 @@ struct file {
     std::string_view input;
     size_t lineNR = 0;
     std::filesystem::path path;
+    std::optional<CacheRecord> cache_record;
 };
 
 
@@ -468,29 +578,60 @@ class ParserState {
         void loadString( const std::string& );
         void loadFile( const std::filesystem::path& );
         void openRootFile( const std::filesystem::path& );
+        void enableCache( const std::filesystem::path& directory, const Parser& parser );
+        void disableCurrentFileCache();
+        void hashKeyword( const std::string& name, const RawKeyword& rawKeyword );
+        void hashDeckKeywords( std::size_t begin );
 
         void handleRandomText(const std::string_view& ) const;
         std::optional<std::filesystem::path> getIncludeFilePath( std::string ) const;
+        std::optional<std::filesystem::path> resolveIncludeFilePath( std::string ) const;
         void addPathAlias( const std::string& alias, const std::string& path );
 
         const std::filesystem::path& current_path() const;
         size_t line() const;
 
-        bool done() const;
+        bool done( bool keyword_open = false );
         std::string_view getline();
         void ungetline(const std::string_view& ln);
-        void closeFile();
+        void closeFile( bool keyword_open = false );
 
         const std::set<Opm::Ecl::SectionType>& get_ignore() {return ignore_sections; };
         bool check_section_keywords(bool& has_edit, bool& has_regions, bool& has_summary);
 
     private:
+        struct IncludePath
+        {
+            std::string name;
+            std::filesystem::path path;
+            bool replaced_backslash = false;
+        };
+
+        std::optional<IncludePath> expandIncludePath( std::string ) const;
+        void prefetchIncludes( std::vector<std::string> includes );
+        bool loadCachedFile( const std::filesystem::path& inputFile, const LoadedFile& loaded );
+
         const std::vector<std::pair<std::string, std::string>> code_keywords;
         InputStack input_stack;
 
         std::set<Opm::Ecl::SectionType> ignore_sections;
         std::map< std::string, std::string > pathMap;
 
+        /*
+          Include files are read and cleaned in the background, at most
+          max_prefetch files ahead of the parser. The pending queue holds
+          the include file names in the order the parser is expected to
+          reach them, and the prefetched files are kept in the same order.
+        */
+        static constexpr std::size_t max_prefetch = 2;
+        std::deque< std::string > pending_includes;
+        std::deque< std::pair< std::filesystem::path, std::future< LoadedFile > > > prefetched;
+
+        std::unique_ptr< DeckCache > deck_cache;
+        const Parser* cache_parser = nullptr;
+        std::uint64_t definition_hash = 0;
+        DeckCache::KeywordHashes keyword_hashes;
+
     public:
         ParserKeywordSizeEnum lastSizeType = SLASH_TERMINATED;
         std::string lastKeyWord;
@@ -511,11 +652,15 @@ size_t ParserState::line() const {
     return this->input_stack.top().lineNR;
 }
 
-bool ParserState::done() const {
+/*
+  Files which have been read to the end are closed; keyword_open signals that
+  the keyword currently being read continues beyond the end of the file.
+*/
+bool ParserState::done( bool keyword_open ) {
 
     while( !this->input_stack.empty() &&
             this->input_stack.top().input.empty() )
-        const_cast< ParserState* >( this )->input_stack.pop();
+        this->closeFile( keyword_open );
 
     return this->input_stack.empty();
 }
@@ -546,7 +691,14 @@ void ParserState::ungetline(const std::string_view& line) {
 
 
 
-void ParserState::closeFile() {
+void ParserState::closeFile( bool keyword_open ) {
+    const auto& record = this->input_stack.top().cache_record;
+    if( record.has_value() && !keyword_open &&
+        (this->errors.size() == record->num_messages) )
+        this->deck_cache->store( record->key, *this->cache_parser, this->deck,
+                                 record->first_keyword, this->deck.size(),
+                                 record->keyword_hashes, this->keyword_hashes );
+
     this->input_stack.pop();
 }
 
@@ -622,38 +774,157 @@ void ParserState::loadString(const std::string& input) {
 }
 
 void ParserState::loadFile(const std::filesystem::path& inputFile) {
+    LoadedFile loaded;
 
-    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
-    std::unique_ptr<std::FILE, decltype(closer)> ufp{
-        std::fopen( inputFile.generic_string().c_str(), "rb" ),
-        closer
-    };
+    /*
+      Prefetched files ahead of this one, or all of them if this one was not
+      prefetched, were not reached in the expected order, e.g. because they
+      are included from an ignored section. They are dropped, after their
+      read has completed, so that they do not occupy the prefetch slots for
+      the rest of the run.
+    */
+    auto prefetch = std::find_if( this->prefetched.begin(), this->prefetched.end(),
+                                  [&inputFile]( const auto& entry ) { return entry.first == inputFile; } );
+    if( prefetch != this->prefetched.end() ) {
+        auto job = std::move( prefetch->second );
+        this->prefetched.erase( this->prefetched.begin(), std::next( prefetch ) );
+        loaded = job.get();
+    } else {
+        this->prefetched.clear();
+        loaded = load_input_file( this->code_keywords, inputFile, this->deck_cache != nullptr );
+    }
 
     // make sure the file we'd like to parse is readable
-    if( !ufp ) {
+    if( !loaded.input.has_value() ) {
         std::string msg = "Could not read from file: " + inputFile.string();
         parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE , msg, {}, errors);
         return;
     }
 
-    /*
-     * read the input file C-style. This is done for performance
-     * reasons, as streams are slow
-     */
+    if( this->deck_cache && this->loadCachedFile( inputFile, loaded ) )
+        return;
 
-    auto* fp = ufp.get();
-    std::string buffer;
-    std::fseek( fp, 0, SEEK_END );
-    buffer.resize( std::ftell( fp ) + 1 );
-    std::rewind( fp );
-    const auto readc = std::fread( &buffer[ 0 ], 1, buffer.size() - 1, fp );
-    buffer.back() = '\n';
+    this->input_stack.push( std::move( loaded.input.value() ), inputFile );
+    if( this->deck_cache )
+        this->input_stack.top().cache_record = CacheRecord {
+            DeckCache::makeKey( inputFile, loaded.content_size, loaded.content_hash,
+                                this->definition_hash, this->parseContext, this->deck ),
+            this->deck.size(),
+            this->errors.size(),
+            this->keyword_hashes
+        };
 
-    if( std::ferror( fp ) || readc != buffer.size() - 1 )
-        throw std::runtime_error( "Error when reading input file '"
-                                  + inputFile.string() + "'" );
+    this->prefetchIncludes( std::move( loaded.includes ) );
+}
+
+/*
+  Only include files are cached; the root file has already been opened when
+  the cache is enabled. The includes prefetched by then were read without
+  hashing their content, so they are read again when the parser reaches
+  them.
+*/
+void ParserState::enableCache( const std::filesystem::path& directory, const Parser& parser ) {
+    this->deck_cache = std::make_unique< DeckCache >( directory, parser );
+    this->cache_parser = &parser;
+    this->definition_hash = parser.definitionHash();
+    this->prefetched.clear();
+}
+
+/*
+  Files which include other files, define PATHS aliases or contain keywords
+  which are not internalized as plain deck keywords are not cached.
+*/
+void ParserState::disableCurrentFileCache() {
+    if( !this->input_stack.empty() )
+        this->input_stack.top().cache_record.reset();
+}
+
+bool ParserState::loadCachedFile( const std::filesystem::path& inputFile, const LoadedFile& loaded ) {
+    const auto key = DeckCache::makeKey( inputFile, loaded.content_size, loaded.content_hash,
+                                         this->definition_hash, this->parseContext, this->deck );
+    auto entry = this->deck_cache->load( key, this->keyword_hashes );
+    if( !entry.has_value() )
+        return false;
+
+    OpmLog::info( fmt::format( "{:5} Loading {} keywords from {} from the deck cache",
+                               this->deck.size(), entry->keywords.size(), inputFile.string() ) );
+
+    for( auto& keyword : entry->keywords ) {
+        this->lastKeyWord = keyword.name();
+        this->lastSizeType = this->cache_parser->getParserKeywordFromDeckName( keyword.name() ).getSizeType();
+        this->deck.addKeyword( std::move( keyword ) );
+    }
+
+    for( const auto& [name, hash] : entry->keyword_hashes )
+        this->keyword_hashes[ name ] = hash;
+
+    return true;
+}
+
+/*
+  The deck cache compares the keywords other keywords depend on, e.g.
+  TABDIMS, by a hash of their raw text. The hash of the last instance of
+  each such keyword is updated as the keyword is added to the deck, so
+  validating a cache entry does not have to revisit the deck.
+*/
+void ParserState::hashKeyword( const std::string& name, const RawKeyword& rawKeyword ) {
+    if( !this->deck_cache || (this->deck_cache->dependencyKeywords().count( name ) == 0) )
+        return;
+
+    auto hash = stableHash( name );
+    for( const auto& record : rawKeyword ) {
+        hash = stableHash( std::string_view( "\0", 1 ), hash );
+        hash = stableHash( record.getRecordString(), hash );
+    }
+
+    this->keyword_hashes[ name ] = hash;
+}
+
+/*
+  Keywords added to the deck without raw text, i.e. by PYINPUT and IMPORT,
+  are hashed in their serialized form instead.
+*/
+void ParserState::hashDeckKeywords( std::size_t begin ) {
+    if( !this->deck_cache )
+        return;
+
+    for( auto index = begin; index < this->deck.size(); ++index ) {
+        const auto& keyword = this->deck[ index ];
+        if( this->deck_cache->dependencyKeywords().count( keyword.name() ) == 0 )
+            continue;
+
+        std::ostringstream os;
+        os << keyword;
+        this->keyword_hashes[ keyword.name() ] = stableHash( os.str() );
+    }
+}
 
-    this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
+/*
+  The includes of the file just opened will be reached before the remaining
+  includes of the enclosing files, hence they go in front of the queue.
+  Names which can not be resolved yet, e.g. because they depend on a PATHS
+  alias which is not defined yet, are skipped and will be read when the
+  parser reaches them.
+*/
+void ParserState::prefetchIncludes( std::vector<std::string> includes ) {
+    this->pending_includes.insert( this->pending_includes.begin(),
+                                   std::make_move_iterator( includes.begin() ),
+                                   std::make_move_iterator( includes.end() ) );
+
+    while( (this->prefetched.size() < max_prefetch) && !this->pending_includes.empty() ) {
+        auto includeFile = this->resolveIncludeFilePath( std::move( this->pending_includes.front() ) );
+        this->pending_includes.pop_front();
+
+        if( !includeFile.has_value() ||
+            std::any_of( this->prefetched.begin(), this->prefetched.end(),
+                         [&includeFile]( const auto& entry ) { return entry.first == includeFile.value(); } ) )
+            continue;
+
+        this->prefetched.emplace_back( includeFile.value(),
+                                       std::async( std::launch::async, load_input_file,
+                                                   this->code_keywords, includeFile.value(),
+                                                   this->deck_cache != nullptr ) );
+    }
 }
 
 /*
@@ -698,7 +969,12 @@ void ParserState::openRootFile( const std::filesystem::path& inputFile) {
     this->rootPath = inputFileCanonical.parent_path();
 }
 
-std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::string path ) const {
+/*
+  Substitutes a PATHS alias, replaces backslashes with slashes, trims and
+  makes the include path absolute. Returns nullopt if the alias is not
+  defined.
+*/
+std::optional<ParserState::IncludePath> ParserState::expandIncludePath( std::string path ) const {
     static const std::string pathKeywordPrefix("$");
     static const std::string validPathNameCharacters("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
 
@@ -708,32 +984,62 @@ std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::strin
         std::string stringStartingAtPathName = path.substr(positionOfPathName+1);
         size_t cutOffPosition = stringStartingAtPathName.find_first_not_of(validPathNameCharacters);
         std::string stringToFind = stringStartingAtPathName.substr(0, cutOffPosition);
-        std::string stringToReplace = this->pathMap.at( stringToFind );
-        replaceAll(path, pathKeywordPrefix + stringToFind, stringToReplace);
-    }
+        auto alias = this->pathMap.find( stringToFind );
+        if (alias == this->pathMap.end())
+            return {};
 
-    // Check if there are any backslashes in the path...
-    if (path.find('\\') != std::string::npos) {
-        // ... if so, replace with slashes and create a warning.
-        std::replace(path.begin(), path.end(), '\\', '/');
-        OpmLog::warning("Replaced one or more backslash with a slash in an INCLUDE path.");
+        replaceAll(path, pathKeywordPrefix + stringToFind, alias->second);
     }
 
+    IncludePath include;
+
+    include.replaced_backslash = path.find('\\') != std::string::npos;
+    std::replace(path.begin(), path.end(), '\\', '/');
+
     // trim leading and trailing whitespace just like the other simulator
     std::regex trim_regex("^\\s+|\\s+$");
-    const auto& trimmed_path = std::regex_replace(path, trim_regex, "");
-    std::filesystem::path includeFilePath(trimmed_path);
+    include.name = std::regex_replace(path, trim_regex, "");
+    include.path = include.name;
+
+    if (include.path.is_relative())
+        include.path = this->rootPath / include.path;
+
+    return include;
+}
+
+/*
+  Resolves an include path without reporting any problems; used to find the
+  files to read ahead of the parser.
+*/
+std::optional<std::filesystem::path> ParserState::resolveIncludeFilePath( std::string path ) const {
+    auto include = this->expandIncludePath( std::move(path) );
+    if (!include.has_value())
+        return {};
 
-    if (includeFilePath.is_relative())
-        includeFilePath = this->rootPath / includeFilePath;
+    std::error_code ec;
+    auto includeFilePath = std::filesystem::canonical(include->path, ec);
+    if (ec)
+        return {};
+
+    return includeFilePath;
+}
+
+std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::string path ) const {
+    auto include = this->expandIncludePath( path );
+    if (!include.has_value())
+        throw std::out_of_range(fmt::format("Undefined PATHS alias in include path '{}'", path));
+
+    if (include->replaced_backslash)
+        OpmLog::warning("Replaced one or more backslash with a slash in an INCLUDE path.");
 
+    std::filesystem::path includeFilePath;
     try {
-        includeFilePath = std::filesystem::canonical(includeFilePath);
+        includeFilePath = std::filesystem::canonical(include->path);
     } catch (const std::filesystem::filesystem_error& fs_error) {
         parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE ,
                                   fmt::format("File '{}' included via INCLUDE"
                                               " directive does not exist.",
-                                              trimmed_path),
+                                              include->name),
                                   {}, errors);
         return {};
     }
@@ -980,7 +1286,7 @@ std::unique_ptr<RawKeyword> tryParseKeyword( ParserState& parserState, const Par
     std::unique_ptr<RawKeyword> rawKeyword;
     std::string_view record_buffer(str::emptystr);
     std::optional<ParserKeyword> parserKeyword;
-    while( !parserState.done() ) {
+    while( !parserState.done( static_cast<bool>( rawKeyword ) ) ) {
         auto line = parserState.getline();
 
         if( line.empty() && !rawKeyword ) continue;
@@ -1388,6 +1694,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         }
 
         if (rawKeyword->getKeywordName() == Opm::RawConsts::paths) {
+            parserState.disableCurrentFileCache();
             for( const auto& record : *rawKeyword ) {
                 std::string pathName = readValueToken<std::string>(record.getItem(0));
                 std::string pathValue = readValueToken<std::string>(record.getItem(1));
@@ -1398,6 +1705,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         }
 
         if (rawKeyword->getKeywordName() == Opm::RawConsts::include) {
+            parserState.disableCurrentFileCache();
             auto& firstRecord = rawKeyword->getFirstRecord( );
             std::string includeFileAsString = readValueToken<std::string>(firstRecord.getItem(0));
             const auto& includeFile = parserState.getIncludeFilePath( includeFileAsString );
@@ -1421,9 +1729,12 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             }
             try {
                 if (rawKeyword->getKeywordName() ==  Opm::RawConsts::pyinput) {
+                    parserState.disableCurrentFileCache();
                     if (parserState.python) {
                         std::string python_string = rawKeyword->getFirstRecord().getRecordString();
+                        const auto first_keyword = parserState.deck.size();
                         parserState.python->exec(python_string, parser, parserState.deck);
+                        parserState.hashDeckKeywords(first_keyword);
                     }
                     else
                         throw std::logic_error("Cannot yet embed Python while still running Python.");
@@ -1436,15 +1747,20 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                                                              parserState.deck.getDefaultUnitSystem());
 
                     if (deck_keyword.name() == ParserKeywords::IMPORT::keywordName) {
+                        parserState.disableCurrentFileCache();
                         bool formatted = deck_keyword.getRecord(0).getItem(1).get<std::string>(0)[0] == 'F';
                         const auto& import_file = parserState.getIncludeFilePath(deck_keyword.getRecord(0).getItem(0).getTrimmedString(0));
 
                         ImportContainer import(parser, parserState.deck.getActiveUnitSystem(), import_file.value().string(), formatted, parserState.deck.size());
+                        const auto first_keyword = parserState.deck.size();
                         for (auto kw : import)
                             parserState.deck.addKeyword(std::move(kw));
+                        parserState.hashDeckKeywords(first_keyword);
                     } else
-                        if (!do_not_add)
+                        if (!do_not_add) {
+                            parserState.hashKeyword( deck_keyword.name(), *rawKeyword );
                             parserState.deck.addKeyword( std::move(deck_keyword) );
+                        }
                 }
             } catch (const OpmInputError& opm_error) {
                 throw;
@@ -1466,6 +1782,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                 std::throw_with_nested(opm_error);
             }
         } else {
+            parserState.disableCurrentFileCache();
             const std::string msg = "The keyword " + rawKeyword->getKeywordName() + " is not recognized - ignored";
             KeywordLocation location(rawKeyword->getKeywordName(), parserState.current_path().string(), parserState.line());
             OpmLog::warning(Log::fileMessage(location, msg));
@@ -1586,6 +1903,19 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             data_file = std::filesystem::proximate(std::filesystem::canonical(dataFileName)).generic_string();
 
         ParserState parserState( this->codeKeywords(), parseContext, errors, data_file, ignore_sections);
+
+        auto cache_directory = this->deck_cache_directory;
+        if (cache_directory.empty()) {
+            const char* env_directory = std::getenv("OPM_DECK_CACHE_DIR");
+            if (env_directory != nullptr)
+                cache_directory = env_directory;
+        }
+
+        // The keywords of ignored sections are removed from the deck, hence
+        // the cache is only used when complete decks are parsed.
+        if (!cache_directory.empty() && ignore_sections.empty())
+            parserState.enableCache( cache_directory, *this );
+
         parseState( parserState, *this );
 
         auto ignore = parserState.get_ignore();
@@ -1634,6 +1964,10 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         return this->parseString(data, ParseContext(), errors);
     }
 
+    void Parser::setDeckCacheDirectory(const std::filesystem::path& directory) {
+        this->deck_cache_directory = directory;
+    }
+
     size_t Parser::size() const {
         return m_deckParserKeywords.size();
     }
@@ -1730,6 +2064,14 @@ const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view
     return *wildCardKeyword;
 }
 
+std::uint64_t Parser::definitionHash() const {
+    auto hash = stableHash( "" );
+    for (const auto& keyword : this->keyword_storage)
+        hash = stableHash( keyword.createCode(), hash );
+
+    return hash;
+}
+
 std::vector<std::string> Parser::getAllDeckNames () const {
     std::vector<std::string> keywords;
     for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
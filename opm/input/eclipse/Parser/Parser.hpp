@@ -20,6 +20,7 @@
 #ifndef OPM_PARSER_HPP
 #define OPM_PARSER_HPP
 
+#include <cstdint>
 #include <filesystem>
 #include <iosfwd>
 #include <list>
@@ -124,6 +125,11 @@ namespace Opm {
         const ParserKeyword& getParserKeywordFromDeckName(const std::string_view& deckKeywordName) const;
         std::vector<std::string> getAllDeckNames () const;
 
+        /// Hash of the definitions of all keywords known to the parser,
+        /// stable across builds.  Changes when a keyword is added or the
+        /// definition of a keyword changes.
+        std::uint64_t definitionHash() const;
+
         void loadKeywords(const Json::JsonObject& jsonKeywords);
         bool loadKeywordFromFile(const std::filesystem::path& configFile);
 
@@ -168,6 +174,12 @@ namespace Opm {
 
         const std::vector<std::pair<std::string,std::string>> codeKeywords() const;
 
+        /// Keep the keywords parsed from INCLUDE files in an on disk cache
+        /// in \p directory, see DeckCache; unchanged include files are then
+        /// loaded from the cache by parseFile(). If no directory is set the
+        /// environment variable OPM_DECK_CACHE_DIR is consulted.
+        void setDeckCacheDirectory(const std::filesystem::path& directory);
+
     private:
         bool hasWildCardKeyword(const std::string& keyword) const;
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
@@ -184,6 +196,7 @@ namespace Opm {
         std::map< std::string_view, const ParserKeyword* > m_wildCardKeywords;
 
         std::vector<std::pair<std::string,std::string>> code_keywords;
+        std::filesystem::path deck_cache_directory;
     };
 
 } // namespace Opm
@@ -17,10 +17,18 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <numeric>
 #include <cmath>
+#include <cstddef>
+#include <exception>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <opm/json/JsonObject.hpp>
 
@@ -457,6 +465,120 @@ std::string ParserItem::createCode(const std::string& indent) const {
 
 namespace {
 
+/*
+  Numeric items of size ALL, e.g. the data of ZCORN or PERMX, can hold
+  hundreds of millions of values. The tokens of such items are scanned in
+  chunks of scan_chunk_size tokens, in parallel and without any per token
+  allocation. A first pass counts the values of each chunk, including
+  repeated values, so that the second pass can convert every chunk straight
+  into its final position in a single value and status buffer. The buffers
+  are then handed over to the deck item as a whole.
+*/
+constexpr std::size_t scan_chunk_size = 1 << 16;
+
+template< typename T, typename Append >
+void scan_numeric_tokens( const RawRecord& record, std::ptrdiff_t begin, std::ptrdiff_t end,
+                          const T default_value, const value::status default_status,
+                          Append&& append ) {
+    for( auto i = begin; i < end; ++i ) {
+        const auto token = record.getItem( i );
+
+        std::string_view countString;
+        std::string_view valueString;
+        if( !isStarToken( token, countString, valueString ) ) {
+            append( 1, readValueToken< T >( token ), value::status::deck_value );
+            continue;
+        }
+
+        const auto count = starTokenCount( token, countString, valueString );
+        if( valueString.empty() )
+            append( count, default_value, default_status );
+        else
+            append( count, readValueToken< T >( valueString ), value::status::deck_value );
+    }
+}
+
+template< typename T >
+void scan_all_numeric( DeckItem& deck_item, const ParserItem& parser_item, const RawRecord& record ) {
+    const bool has_default = parser_item.hasDefault();
+    const T default_value = has_default ? parser_item.getDefault< T >() : T{};
+    const auto default_status = has_default ? value::status::valid_default : value::status::empty_default;
+
+    const auto chunk_size = static_cast< std::ptrdiff_t >( scan_chunk_size );
+    const auto num_tokens = static_cast< std::ptrdiff_t >( record.size() );
+    const auto num_chunks = (num_tokens + chunk_size - 1) / chunk_size;
+
+    // Report the first offending token, as sequential scanning would.
+    const auto rethrow_first = [&]( const std::vector< std::exception_ptr >& errors ) {
+        for( const auto& error : errors ) {
+            if( error )
+                std::rethrow_exception( error );
+        }
+    };
+
+    std::vector< std::size_t > offset( num_chunks + 1, 0 );
+    std::vector< std::exception_ptr > errors( num_chunks );
+
+#pragma omp parallel for schedule(static) if(num_chunks > 1)
+    for( std::ptrdiff_t chunk = 0; chunk < num_chunks; ++chunk ) {
+        const auto begin = chunk * chunk_size;
+        const auto end = std::min( num_tokens, begin + chunk_size );
+
+        try {
+            std::size_t count = 0;
+            for( auto i = begin; i < end; ++i ) {
+                const auto token = record.getItem( i );
+
+                std::string_view countString;
+                std::string_view valueString;
+                count += isStarToken( token, countString, valueString )
+                    ? starTokenCount( token, countString, valueString ) : 1;
+            }
+
+            offset[chunk + 1] = count;
+        }
+        catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    }
+
+    if( std::any_of( errors.begin(), errors.end(), []( const auto& error ) { return bool( error ); } ) ) {
+        // A malformed repeat count. Rescan sequentially, without storing
+        // the values, so that a bad value ahead of it is reported first.
+        scan_numeric_tokens< T >( record, 0, num_tokens, default_value, default_status,
+                                  []( std::size_t, const T&, value::status ) {} );
+        rethrow_first( errors );
+    }
+
+    std::partial_sum( offset.begin(), offset.end(), offset.begin() );
+
+    std::vector< T > values( offset.back() );
+    std::vector< value::status > status( offset.back() );
+
+#pragma omp parallel for schedule(static) if(num_chunks > 1)
+    for( std::ptrdiff_t chunk = 0; chunk < num_chunks; ++chunk ) {
+        const auto begin = chunk * chunk_size;
+        const auto end = std::min( num_tokens, begin + chunk_size );
+        auto pos = offset[chunk];
+
+        try {
+            scan_numeric_tokens< T >( record, begin, end, default_value, default_status,
+                                      [&]( std::size_t count, const T& value, value::status value_status ) {
+                                          std::fill_n( values.begin() + pos, count, value );
+                                          std::fill_n( status.begin() + pos, count, value_status );
+                                          pos += count;
+                                      } );
+        }
+        catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    }
+
+    rethrow_first( errors );
+
+    deck_item.push_back( std::move( values ), std::move( status ) );
+}
+
 template< typename T >
 void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& record ) {
     bool parse_raw = parser_item.parseRaw();
@@ -472,6 +594,12 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
             return;
         }
 
+        if constexpr (std::is_same_v< T, int > || std::is_same_v< T, double >) {
+            scan_all_numeric< T >( deck_item, parser_item, record );
+            record.pop_front( record.size() );
+            return;
+        }
+
         while( record.size() > 0 ) {
             auto token = record.pop_front();
 
@@ -39,6 +39,7 @@ class KeywordLocation;
         explicit RawRecord( const std::string_view&, const KeywordLocation&);
 
         inline std::string_view pop_front();
+        inline void pop_front( std::size_t count );
         inline std::string_view front() const;
         void push_front( std::string_view token, std::size_t count );
         inline size_t size() const;
@@ -63,6 +64,11 @@ class KeywordLocation;
         return result;
     }
 
+    void RawRecord::pop_front( std::size_t count ) {
+        this->m_recordItems.erase( this->m_recordItems.begin(),
+                                   this->m_recordItems.begin() + count );
+    }
+
     std::string_view RawRecord::front() const {
         return this->m_recordItems.front();
     }
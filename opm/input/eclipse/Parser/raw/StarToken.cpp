@@ -17,19 +17,21 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <config.h>
+
 #include <opm/input/eclipse/Parser/raw/StarToken.hpp>
 
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 #include <opm/input/eclipse/Utility/Typetools.hpp>
 
-#include <boost/spirit/include/qi.hpp>
-
+#include <algorithm>
+#include <array>
 #include <cctype>
+#include <charconv>
 #include <cstdlib>
 #include <stdexcept>
 #include <string>
-
-namespace qi = boost::spirit::qi;
+#include <system_error>
 
 namespace Opm {
 
@@ -41,18 +43,19 @@ namespace Opm {
     }
 
     bool isStarToken(const std::string_view& token,
-                           std::string& countString,
-                           std::string& valueString) {
+                           std::string_view& countString,
+                           std::string_view& valueString) {
         // find first character which is not a digit
         size_t pos = 0;
         for (; pos < token.length(); ++pos)
-            if (!std::isdigit(token[pos]))
+            if (!std::isdigit(static_cast<unsigned char>(token[pos])))
                 break;
 
         // if no such character exists or if this character is not a star, the token is
         // not a "star token" (i.e. it is not a "repeat this value N times" token.
         if (pos >= token.size() || token[pos] != '*')
             return false;
+
         // Quote from the Eclipse Reference Manual: "An asterisk by
         // itself is not sufficent". However, our experience is that
         // Eclipse accepts such tokens and we therefore interpret "*"
@@ -63,52 +66,135 @@ namespace Opm {
         // StarToken<T>. (Because Eclipse does not seem to
         // accept these and we would stay as closely to the spec as
         // possible.)
-        else if (pos == 0) {
-            countString = "";
-            valueString = std::string(token.substr(pos + 1));
-            return true;
-        }
-
+        //
         // if a star is prefixed by an unsigned integer N, then this should be
         // interpreted as "repeat value after star N times"
-        countString = std::string(token.substr(0, pos));
-        valueString = std::string(token.substr(pos + 1));
+        countString = token.substr(0, pos);
+        valueString = token.substr(pos + 1);
         return true;
     }
 
-    template<>
-    int readValueToken< int >( std::string_view view ) {
-        int n = 0;
-        auto cursor = view.begin();
-        const bool ok = qi::parse( cursor, view.end(), qi::int_, n );
+    bool isStarToken(const std::string_view& token,
+                           std::string& countString,
+                           std::string& valueString) {
+        std::string_view countView;
+        std::string_view valueView;
+        if (!isStarToken(token, countView, valueView))
+            return false;
 
-        if( ok && cursor == view.end() ) return n;
-        throw std::invalid_argument( "Malformed integer '" + std::string(view) + "'" );
+        countString = std::string(countView);
+        valueString = std::string(valueView);
+        return true;
+    }
+
+    std::size_t starTokenCount(const std::string_view& token,
+                               const std::string_view& countString,
+                               const std::string_view& valueString) {
+        // special-case the interpretation of a lone star as "1*" but do not
+        // allow constructs like "*123"...
+        if (countString.empty()) {
+            if (!valueString.empty())
+                // TODO: decorate the deck with a warning instead?
+                throw std::invalid_argument("Not specifying a count also implies not specifying a value. Token: \'" + std::string(token) + "\'.");
+
+            // TODO: since this is explicitly forbidden by the documentation it might
+            // be a good idea to decorate the deck with a warning?
+            return 1;
+        }
+
+        int cnt = 0;
+        const auto [ptr, ec] = std::from_chars(countString.data(), countString.data() + countString.size(), cnt);
+        if (ec == std::errc::result_out_of_range)
+            throw std::out_of_range("Repetition count out of range. Token: \'" + std::string(token) + "\'.");
+
+        if ((ec != std::errc{}) || (ptr != countString.data() + countString.size()))
+            throw std::invalid_argument("Malformed repetition count. Token: \'" + std::string(token) + "\'.");
+
+        if (cnt < 1)
+            // TODO: decorate the deck with a warning instead?
+            throw std::invalid_argument("Specifying zero repetitions is not allowed. Token: \'" + std::string(token) + "\'.");
+
+        return static_cast<std::size_t>(cnt);
     }
 
-    template< typename T >
-    struct fortran_double : qi::real_policies< T > {
-        // Eclipse supports Fortran syntax for specifying exponents of floating point
-        // numbers ('D' and 'E', e.g., 1.234d5)
-        template< typename It >
-        static bool parse_exp( It& first, const It& last ) {
-            if( first == last ||
-                (*first != 'e' && *first != 'E' &&
-                *first != 'd' && *first != 'D' ) )
+    namespace {
+
+        /*
+          Numbers are converted with std::from_chars(), which neither allocates
+          nor depends on the locale. It does however not accept a leading '+',
+          nor the Fortran exponent characters 'd' and 'D' which Eclipse supports
+          (e.g., 1.234d5), so those are handled here. Standard libraries without
+          the floating point overloads of std::from_chars() fall back to
+          strtod().
+        */
+        std::string_view skip_plus_sign( std::string_view view ) {
+            if( (view.size() > 1) && (view.front() == '+') && (view[1] != '+') && (view[1] != '-') )
+                view.remove_prefix( 1 );
+
+            return view;
+        }
+
+        bool parse_int( std::string_view view, int& n ) {
+            view = skip_plus_sign( view );
+
+            const auto* end = view.data() + view.size();
+            const auto [ptr, ec] = std::from_chars( view.data(), end, n );
+            return (ec == std::errc{}) && (ptr == end);
+        }
+
+        bool parse_double( std::string_view view, double& n ) {
+            view = skip_plus_sign( view );
+
+            // Fortran exponent; copy to a local buffer with 'e' as exponent character.
+            std::array< char, 64 > buffer;
+            const auto exp_pos = view.find_first_of( "dD" );
+            if( exp_pos != std::string_view::npos ) {
+                if( view.size() > buffer.size() )
+                    return false;
+
+                std::copy( view.begin(), view.end(), buffer.begin() );
+                buffer[ exp_pos ] = 'e';
+                view = std::string_view( buffer.data(), view.size() );
+            }
+
+#if HAVE_FLOAT_FROM_CHARS
+            const auto* end = view.data() + view.size();
+            const auto [ptr, ec] = std::from_chars( view.data(), end, n );
+            if( ptr != end )
+                return false;
+
+            // Values beyond the range of double are rare; let strtod() decide
+            // between underflow to zero and overflow to infinity.
+            if( ec == std::errc::result_out_of_range ) {
+                n = std::strtod( std::string( view ).c_str(), nullptr );
+                return true;
+            }
+
+            return ec == std::errc{};
+#else
+            if( view.empty() || std::isspace( static_cast< unsigned char >( view.front() ) ) )
                 return false;
-            ++first;
-            return true;
+
+            const auto str = std::string( view );
+            char* end = nullptr;
+            n = std::strtod( str.c_str(), &end );
+            return end == str.c_str() + str.size();
+#endif
         }
-    };
+
+    }
+
+    template<>
+    int readValueToken< int >( std::string_view view ) {
+        int n = 0;
+        if( parse_int( view, n ) ) return n;
+        throw std::invalid_argument( "Malformed integer '" + std::string(view) + "'" );
+    }
 
     template<>
     double readValueToken< double >( std::string_view view ) {
         double n = 0;
-        qi::real_parser< double, fortran_double< double > > double_;
-        auto cursor = view.begin();
-        const auto ok = qi::parse( cursor, view.end(), double_, n );
-
-        if( ok && cursor == view.end() ) return n;
+        if( parse_double( view, n ) ) return n;
         throw std::invalid_argument( "Malformed floating point number '" + std::string(view) + "'" );
     }
 
@@ -133,35 +219,12 @@ namespace Opm {
     template<>
     UDAValue readValueToken< UDAValue >( std::string_view view ) {
         double n = 0;
-        qi::real_parser< double, fortran_double< double > > double_;
-        auto cursor = view.begin();
-        const auto ok = qi::parse( cursor, view.end(), double_, n );
-
-        if( ok && cursor == view.end() ) return UDAValue(n);
+        if( parse_double( view, n ) ) return UDAValue(n);
         return UDAValue( readValueToken<std::string>(view) );
     }
 
     void StarToken::init_( const std::string_view& token ) {
-        // special-case the interpretation of a lone star as "1*" but do not
-        // allow constructs like "*123"...
-        if (m_countString == "") {
-            if (m_valueString != "")
-                // TODO: decorate the deck with a warning instead?
-                throw std::invalid_argument("Not specifying a count also implies not specifying a value. Token: \'" + std::string(token) + "\'.");
-
-            // TODO: since this is explicitly forbidden by the documentation it might
-            // be a good idea to decorate the deck with a warning?
-            m_count = 1;
-        }
-        else {
-            const auto cnt = std::stoi( m_countString );
-
-            if (cnt < 1)
-                // TODO: decorate the deck with a warning instead?
-                throw std::invalid_argument("Specifying zero repetitions is not allowed. Token: \'" + std::string(token) + "\'.");
-
-            m_count = static_cast<std::size_t>(cnt);
-        }
+        m_count = starTokenCount( token, m_countString, m_valueString );
     }
 
 }
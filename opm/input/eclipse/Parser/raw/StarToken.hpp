@@ -30,6 +30,19 @@ namespace Opm {
                            std::string& countString,
                            std::string& valueString);
 
+    // Same as above, but the count and value parts are returned as views
+    // into the token, i.e. without allocating.
+    bool isStarToken(const std::string_view& token,
+                           std::string_view& countString,
+                           std::string_view& valueString);
+
+    // The repetition count of a star token which has been split by
+    // isStarToken(); throws std::invalid_argument for the same malformed
+    // tokens as the StarToken constructor.
+    std::size_t starTokenCount(const std::string_view& token,
+                               const std::string_view& countString,
+                               const std::string_view& valueString);
+
     template <class T>
     T readValueToken( std::string_view );
 
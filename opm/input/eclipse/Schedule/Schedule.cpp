@@ -98,6 +98,8 @@
 #include "Well/injection.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <ctime>
 #include <functional>
 #include <initializer_list>
@@ -114,6 +116,8 @@
 
 namespace {
 
+    std::atomic<std::uint64_t> schedule_revision { 0 };
+
     bool name_match_any(const std::unordered_set<std::string>& patterns,
                         const std::string& name)
     {
@@ -742,6 +746,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     void Schedule::applyGlobalWPIMULT( const std::unordered_map<std::string, double>& wpimult_global_factor) {
+        this->m_revision = nextRevision();
+
         for (const auto& [well_name, factor] : wpimult_global_factor) {
             auto well = this->snapshots.back().wells(well_name);
             if (well.applyGlobalWPIMULT(factor)) {
@@ -961,6 +967,8 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
     }
 
     void Schedule::clear_event(ScheduleEvents::Events event, std::size_t report_step) {
+        this->m_revision = nextRevision();
+
         auto events = this->snapshots[report_step].events();
         events.clearEvent(event);
         this->snapshots[report_step].update_events(events);
@@ -968,6 +976,8 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
 
     void Schedule::add_event(ScheduleEvents::Events event, std::size_t report_step)
     {
+        this->m_revision = nextRevision();
+
         auto events = this->snapshots[report_step].events();
         events.addEvent(event);
         this->snapshots[report_step].update_events(events);
@@ -1563,6 +1573,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
 
     void Schedule::filterConnections(const ActiveGridCells& grid) {
+        this->m_revision = nextRevision();
+
         for (auto& sched_state : this->snapshots) {
             for (auto& well : sched_state.wells()) {
                 well.get().filterConnections(grid);
@@ -1625,6 +1637,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     void Schedule::applyKeywords(std::vector<std::unique_ptr<DeckKeyword>>& keywords, std::unordered_map<std::string, double>& target_wellpi,
                                  bool action_mode, const std::size_t reportStep)
     {
+        this->m_revision = nextRevision();
+
         if (reportStep < this->current_report_step) {
             throw std::invalid_argument {
                 fmt::format("Insert keyword for past report step {} "
@@ -1732,6 +1746,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                           const Action::Result::MatchingEntities& matches,
                           const std::unordered_map<std::string, double>& target_wellpi)
     {
+        this->m_revision = nextRevision();
+
         const std::string prefix = "| ";
         ParseContext parseContext;
         if (this->m_treat_critical_as_non_critical) { // Continue with invalid names if parsing strictness is set to low
@@ -1803,6 +1819,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     Schedule::modifyCompletions(const std::size_t reportStep,
                                 const std::map<std::string, std::vector<Connection>>& extraConns)
     {
+        this->m_revision = nextRevision();
+
         SimulatorUpdate sim_update{};
 
         this->snapshots.resize(reportStep + 1);
@@ -1997,6 +2015,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                                           SummaryState& summary_state,
                                           const std::unordered_map<std::string, double>& target_wellpi)
     {
+        this->m_revision = nextRevision();
+
         // Reset simUpdateFromPython, pyaction.run(...) will run through the PyAction script, the calls that trigger a simulator update will append this to simUpdateFromPython.
         this->simUpdateFromPython->reset();
         // Set the current_report_step to the report step in which this PyAction was triggered.
@@ -2016,6 +2036,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     void Schedule::applyWellProdIndexScaling(const std::string& well_name, const std::size_t reportStep, const double newWellPI) {
+        this->m_revision = nextRevision();
+
         if (reportStep >= this->snapshots.size())
             return;
 
@@ -2096,6 +2118,11 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         return keywords;
     }
 
+    std::uint64_t Schedule::nextRevision()
+    {
+        return ++schedule_revision;
+    }
+
     bool Schedule::operator==(const Schedule& data) const {
         // If this has a simUpdateFromPython pointer and data does not
         // (or the other way round), then they are *not* equal.
@@ -2699,6 +2726,8 @@ std::vector<ScheduleState>::const_iterator Schedule::end() const {
 }
 
 void Schedule::create_first(const time_point& start_time, const std::optional<time_point>& end_time) {
+    this->m_revision = nextRevision();
+
     if (end_time.has_value())
         this->snapshots.emplace_back( start_time, end_time.value() );
     else
@@ -2743,6 +2772,8 @@ void Schedule::create_first(const time_point& start_time, const std::optional<ti
 }
 
 void Schedule::create_next(const time_point& start_time, const std::optional<time_point>& end_time) {
+    this->m_revision = nextRevision();
+
     if (this->snapshots.empty())
         this->create_first(start_time, end_time);
     else {
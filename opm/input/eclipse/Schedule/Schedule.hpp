@@ -20,6 +20,7 @@
 #define SCHEDULE_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <functional>
 #include <iosfwd>
@@ -312,6 +313,16 @@ namespace Opm {
         void add_event(ScheduleEvents::Events, std::size_t report_step);
         void applyWellProdIndexScaling(const std::string& well_name, const std::size_t reportStep, const double scalingFactor);
 
+        /// Revision of the schedule's contents.
+        ///
+        /// Changes whenever the schedule is modified after construction,
+        /// e.g., by applyAction(), applyKeywords() or runPyAction(), also
+        /// within a report step.  Two schedule objects only share a
+        /// revision if one is an unmodified copy of the other.  Callers
+        /// which cache Well or Group pointers, or other data derived from
+        /// the schedule, must discard them when the revision changes.
+        std::uint64_t revision() const { return this->m_revision; }
+
         WellProducerCMode getGlobalWhistctlMmode(std::size_t timestep) const;
 
         const UDQConfig& getUDQConfig(std::size_t timeStep) const;
@@ -425,6 +436,7 @@ namespace Opm {
             // with multiple pointers to any given instance, but it is not
             // significant so let's keep it simple.
             if (!serializer.isSerializing()) {
+                this->m_revision = nextRevision();
                 for (auto& snapshot : snapshots) {
                     for (auto& well : snapshot.wells) {
                         well.second->updateUnitSystem(&m_static.m_unit_system);
@@ -488,6 +500,12 @@ namespace Opm {
         // The copy constructor is needed for creating a mocked simulator (msim).
         std::shared_ptr<SimulatorUpdate> simUpdateFromPython{};
 
+        // Identifies the current contents, see revision().  Not part of the
+        // schedule's value, so neither compared nor serialized.
+        std::uint64_t m_revision = nextRevision();
+
+        static std::uint64_t nextRevision();
+
         void load_rst(const RestartIO::RstState& rst,
                       const TracerConfig& tracer_config,
                       const ScheduleGrid& grid,
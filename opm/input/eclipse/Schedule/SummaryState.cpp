@@ -26,16 +26,21 @@
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <ctime>
 #include <iomanip>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <ostream>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -112,60 +117,89 @@ namespace {
             return is_total(key.substr(0,sep_pos));
     }
 
-    template <class T>
-    using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
+    // Entry of a nested map, or nullptr if there is no such entry.
+    template <class Map, class Key>
+    auto find_entry(const Map& map, const Key& key)
+        -> const typename Map::mapped_type*
+    {
+        auto pos = map.find(key);
+        return (pos == map.end()) ? nullptr : &pos->second;
+    }
 
-    template <class T>
-    bool has_var(const map2<T>& values,
-                 const std::string& var1,
-                 const std::string& var2)
+    template <class Map, class Key, class... Keys>
+    auto find_entry(const Map& map, const Key& key, const Keys&... keys)
     {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return false;
+        const auto* inner = find_entry(map, key);
 
-        const auto& var2_iter = var1_iter->second.find(var2);
-        if (var2_iter == var1_iter->second.end())
-            return false;
+        using Entry = decltype(find_entry(*inner, keys...));
+        return (inner == nullptr) ? Entry{nullptr} : find_entry(*inner, keys...);
+    }
 
-        return true;
+    // Remove the entry holding 'slot' from a nested slot map, along with
+    // any inner map left empty.
+    template <class Map>
+    bool remove_entry(Map& map, const std::size_t slot)
+    {
+        for (auto pos = map.begin(); pos != map.end(); ++pos) {
+            if constexpr (std::is_same_v<typename Map::mapped_type, std::size_t>) {
+                if (pos->second == slot) {
+                    map.erase(pos);
+                    return true;
+                }
+            }
+            else if (remove_entry(pos->second, slot)) {
+                if (pos->second.empty()) {
+                    map.erase(pos);
+                }
+
+                return true;
+            }
+        }
+
+        return false;
     }
 
-    template <class T>
-    void erase_var(map2<T>& values,
-                   std::set<std::string>& var2_set,
-                   const std::string& var1,
-                   const std::string& var2)
+    // Copy the defined values of a nested slot map into the nested value
+    // map of the same shape.
+    template <class SlotMap, class ValueMap, class Value>
+    void collect_values(const SlotMap& slots, ValueMap& values, const Value& value)
     {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return;
+        for (const auto& [key, entry] : slots) {
+            if constexpr (std::is_same_v<typename SlotMap::mapped_type, std::size_t>) {
+                if (const auto v = value(entry); v.has_value()) {
+                    values.emplace(key, *v);
+                }
+            }
+            else {
+                auto inner = typename ValueMap::mapped_type{};
+                collect_values(entry, inner, value);
 
-        var1_iter->second.erase(var2);
-        var2_set.clear();
-        for (const auto& [_, var2_map] : values) {
-            (void)_;
-            for (const auto& [v2, __] : var2_map) {
-                (void)__;
-                var2_set.insert(v2);
+                if (! inner.empty()) {
+                    values.emplace(key, std::move(inner));
+                }
             }
         }
     }
 
-    template <class T>
-    std::vector<std::string>
-    var2_list(const map2<T>& values, const std::string& var1)
+    // Sorted names, from the second level of a slot map, which have at
+    // least one defined slot.
+    template <class SlotMap, class Defined>
+    std::vector<std::string> defined_names(const SlotMap& slots, const Defined& defined)
     {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return {};
+        auto names = std::vector<std::string>{};
+
+        for (const auto& var : slots) {
+            for (const auto& [name, slot] : var.second) {
+                if (defined(slot)) {
+                    names.push_back(name);
+                }
+            }
+        }
 
-        std::vector<std::string> l;
-        std::transform(var1_iter->second.begin(), var1_iter->second.end(),
-                       std::back_inserter(l),
-                       [](const auto& pair) { return pair.first; });
+        std::sort(names.begin(), names.end());
+        names.erase(std::unique(names.begin(), names.end()), names.end());
 
-        return l;
+        return names;
     }
 
     std::string normalise_region_set_name(const std::string& regSet)
@@ -204,11 +238,132 @@ namespace {
         return node.unique_key();
     }
 
+    enum KeyFlag : unsigned char
+    {
+        Total   = 1 << 0,
+        UDQ     = 1 << 1,
+        Well    = 1 << 2,
+        Group   = 1 << 3,
+        Conn    = 1 << 4,
+        Segment = 1 << 5,
+        Region  = 1 << 6,
+    };
+
+    std::uint64_t next_key_table_id()
+    {
+        static std::atomic<std::uint64_t> id { 0 };
+        return ++id;
+    }
+
 } // Anonymous namespace
 
 namespace Opm
 {
 
+    SummaryState::const_iterator::const_iterator(const SummaryState* st,
+                                                 const slot_type     slot)
+        : st_   { st }
+        , slot_ { slot }
+    {
+        this->skipUndefined();
+    }
+
+    SummaryState::const_iterator::reference
+    SummaryState::const_iterator::operator*() const
+    {
+        return { this->st_->key_table->keys[this->slot_],
+                 this->st_->slot_values[this->slot_] };
+    }
+
+    SummaryState::const_iterator&
+    SummaryState::const_iterator::operator++()
+    {
+        ++this->slot_;
+        this->skipUndefined();
+
+        return *this;
+    }
+
+    SummaryState::const_iterator
+    SummaryState::const_iterator::operator++(int)
+    {
+        auto prev = *this;
+        ++*this;
+
+        return prev;
+    }
+
+    void SummaryState::const_iterator::skipUndefined()
+    {
+        const auto& defined = this->st_->slot_defined;
+        while ((this->slot_ < defined.size()) && !defined[this->slot_]) {
+            ++this->slot_;
+        }
+    }
+
+    // -----------------------------------------------------------------------
+
+    SummaryState::KeyTableRef::KeyTableRef()
+        : table_ { std::make_shared<KeyTable>() }
+    {
+        this->table_->id = next_key_table_id();
+    }
+
+    SummaryState::KeyTableRef::KeyTableRef(const KeyTableRef& rhs)
+        : table_  { rhs.table_ }
+        , shared_ { true }
+    {
+        rhs.shared_ = true;
+    }
+
+    SummaryState::KeyTableRef::KeyTableRef(KeyTableRef&& rhs) noexcept
+        : table_  { std::move(rhs.table_) }
+        , shared_ { rhs.shared_.load() }
+    {}
+
+    SummaryState::KeyTableRef&
+    SummaryState::KeyTableRef::operator=(const KeyTableRef& rhs)
+    {
+        if (this != &rhs) {
+            rhs.shared_ = true;
+            this->table_ = rhs.table_;
+            this->shared_ = true;
+        }
+
+        return *this;
+    }
+
+    SummaryState::KeyTableRef&
+    SummaryState::KeyTableRef::operator=(KeyTableRef&& rhs) noexcept
+    {
+        this->table_ = std::move(rhs.table_);
+        this->shared_ = rhs.shared_.load();
+
+        return *this;
+    }
+
+    SummaryState::KeyTable& SummaryState::KeyTableRef::writable()
+    {
+        if (this->shared_) {
+            this->table_ = std::make_shared<KeyTable>(*this->table_);
+            this->shared_ = false;
+        }
+
+        return *this->table_;
+    }
+
+    bool SummaryState::VariableValues::operator==(const VariableValues& that) const
+    {
+        return (this->well == that.well)
+            && (this->group == that.group)
+            && (this->conn == that.conn)
+            && (this->segment == that.segment)
+            && (this->region == that.region)
+            ;
+    }
+
+    // -----------------------------------------------------------------------
+
     SummaryState::SummaryState(const time_point sim_start_arg,
                                const double     udqUndefined)
         : sim_start     { sim_start_arg }
@@ -222,101 +377,490 @@ namespace Opm
                          std::numeric_limits<double>::lowest() }
     {}
 
-    void SummaryState::set(const std::string& key, double value)
+    SummaryState::slot_type SummaryState::intern(const std::string& key)
+    {
+        if (auto pos = this->key_table->index.find(key);
+            pos != this->key_table->index.end())
+        {
+            return pos->second;
+        }
+
+        auto& table = this->key_table.writable();
+        const auto flags = static_cast<unsigned char>
+            ((is_total(key) ? KeyFlag::Total : 0) |
+             (is_udq(key)   ? KeyFlag::UDQ   : 0));
+
+        auto slot = table.keys.size();
+        if (! table.free_slots.empty()) {
+            // Reuse the slot of an erased key.
+            slot = table.free_slots.back();
+            table.free_slots.pop_back();
+
+            table.keys[slot] = key;
+            table.flags[slot] = flags;
+        }
+        else {
+            table.keys.push_back(key);
+            table.flags.push_back(flags);
+
+            this->slot_values.push_back(0.0);
+            this->slot_defined.push_back(false);
+        }
+
+        table.id = next_key_table_id();
+        table.index.emplace(key, slot);
+
+        return slot;
+    }
+
+    std::vector<SummaryState::slot_type>
+    SummaryState::intern(const std::vector<std::string>& keys)
     {
-        this->values.insert_or_assign(key, value);
+        auto slots = std::vector<slot_type>{};
+        slots.reserve(keys.size());
+
+        for (const auto& key : keys) {
+            slots.push_back(this->intern(key));
+        }
+
+        return slots;
     }
 
-    bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+    std::optional<SummaryState::slot_type>
+    SummaryState::find_slot(const std::string& key) const
+    {
+        auto pos = this->key_table->index.find(key);
+        if (pos == this->key_table->index.end()) {
+            return std::nullopt;
+        }
+
+        return pos->second;
     }
 
-    bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
+    const std::string& SummaryState::slot_key(const slot_type slot) const
+    {
+        return this->key_table->keys.at(slot);
+    }
+
+    std::size_t SummaryState::num_slots() const
+    {
+        return this->key_table->keys.size();
+    }
+
+    std::uint64_t SummaryState::key_table_id() const
+    {
+        return this->key_table->id;
+    }
+
+    bool SummaryState::has_slot(const slot_type slot) const
+    {
+        return this->slot_defined[slot]
+            || ((this->key_table->flags[slot] & KeyFlag::UDQ) != 0);
+    }
+
+    double SummaryState::get_slot(const slot_type slot) const
+    {
+        if (this->slot_defined[slot]) {
+            return this->slot_values[slot];
+        }
+
+        if ((this->key_table->flags[slot] & KeyFlag::UDQ) != 0) {
+            return this->udq_undefined;
+        }
+
+        throw std::out_of_range {
+            fmt::format("Summary vector {} is unknown",
+                        this->key_table->keys[slot])
+        };
+    }
+
+    double SummaryState::get_slot(const slot_type slot,
+                                  const double    default_value) const
+    {
+        if (this->slot_defined[slot]) {
+            return this->slot_values[slot];
+        }
+
+        if ((this->key_table->flags[slot] & KeyFlag::UDQ) != 0) {
+            return this->udq_undefined;
+        }
+
+        return default_value;
+    }
+
+    void SummaryState::set_slot(const slot_type slot, const double value)
+    {
+        this->define_slot(slot);
+        this->slot_values[slot] = value;
+    }
+
+    void SummaryState::update_slot(const slot_type slot, const double value)
+    {
+        if (! this->slot_defined[slot]) {
+            this->slot_values[slot] = 0.0;
+            this->define_slot(slot);
+        }
+
+        if ((this->key_table->flags[slot] & KeyFlag::Total) != 0) {
+            this->slot_values[slot] += value;
+        }
+        else {
+            this->slot_values[slot] = value;
+        }
+    }
+
+    SummaryState::slot_type
+    SummaryState::well_var_slot(const std::string& well,
+                                const std::string& var)
+    {
+        if (const auto* slot = find_entry(this->key_table->well_slots, var, well);
+            slot != nullptr)
+        {
+            return *slot;
+        }
+
+        const auto slot = this->intern(fmt::format("{}:{}", var, well));
+
+        auto& table = this->key_table.writable();
+        table.well_slots[var].insert_or_assign(well, slot);
+        this->register_slot(table, slot, KeyFlag::Well);
+
+        return slot;
+    }
+
+    SummaryState::slot_type
+    SummaryState::group_var_slot(const std::string& group,
+                                 const std::string& var)
+    {
+        if (const auto* slot = find_entry(this->key_table->group_slots, var, group);
+            slot != nullptr)
+        {
+            return *slot;
+        }
+
+        const auto slot = this->intern(fmt::format("{}:{}", var, group));
+
+        auto& table = this->key_table.writable();
+        table.group_slots[var].insert_or_assign(group, slot);
+        this->register_slot(table, slot, KeyFlag::Group);
+
+        return slot;
+    }
+
+    SummaryState::slot_type
+    SummaryState::conn_var_slot(const std::string& well,
+                                const std::string& var,
+                                const std::size_t  global_index)
+    {
+        if (const auto* slot = find_entry(this->key_table->conn_slots, var, well, global_index);
+            slot != nullptr)
+        {
+            return *slot;
+        }
+
+        const auto slot = this->intern(fmt::format("{}:{}:{}", var, well, global_index));
+
+        auto& table = this->key_table.writable();
+        table.conn_slots[var][well].insert_or_assign(global_index, slot);
+        this->register_slot(table, slot, KeyFlag::Conn);
+
+        return slot;
+    }
+
+    SummaryState::slot_type
+    SummaryState::segment_var_slot(const std::string& well,
+                                   const std::string& var,
+                                   const std::size_t  segment)
+    {
+        if (const auto* slot = find_entry(this->key_table->segment_slots, var, well, segment);
+            slot != nullptr)
+        {
+            return *slot;
+        }
+
+        const auto slot = this->intern(fmt::format("{}:{}:{}", var, well, segment));
+
+        auto& table = this->key_table.writable();
+        table.segment_slots[var][well].insert_or_assign(segment, slot);
+        this->register_slot(table, slot, KeyFlag::Segment);
+
+        return slot;
+    }
+
+    SummaryState::slot_type
+    SummaryState::region_var_slot(const std::string& regSet,
+                                  const std::string& var,
+                                  const std::size_t  region)
+    {
+        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
+        const auto regSetName = normalise_region_set_name(regSet);
+
+        if (const auto* slot = find_entry(this->key_table->region_slots, regKw, regSetName, region);
+            slot != nullptr)
+        {
+            return *slot;
+        }
+
+        const auto slot = this->intern(region_key(regKw, regSet, region));
+
+        auto& table = this->key_table.writable();
+        table.region_slots[regKw][regSetName].insert_or_assign(region, slot);
+        this->register_slot(table, slot, KeyFlag::Region);
+
+        return slot;
+    }
+
+    bool SummaryState::is_defined(const slot_type* slot) const
+    {
+        return (slot != nullptr) && this->slot_defined[*slot];
+    }
+
+    void SummaryState::define_slot(const slot_type slot)
+    {
+        if (this->slot_defined[slot]) {
+            return;
+        }
+
+        this->slot_defined[slot] = true;
+        ++this->num_defined;
+
+        const auto flags = this->key_table->flags[slot];
+        if ((flags & KeyFlag::Well) != 0) {
+            this->well_names.reset();
+        }
+
+        if ((flags & KeyFlag::Group) != 0) {
+            this->group_names.reset();
+        }
+    }
+
+    void SummaryState::register_slot(KeyTable&           table,
+                                     const slot_type     slot,
+                                     const unsigned char kind)
+    {
+        table.flags[slot] |= kind;
+        table.id = next_key_table_id();
+
+        if (this->slot_defined[slot]) {
+            // Value already set through the general key.
+            this->well_names.reset();
+            this->group_names.reset();
+        }
+    }
+
+    bool SummaryState::remove_slot(const slot_type slot)
     {
-        std::string key = var + ":" + well;
-        if (!this->erase(key))
+        if (! this->slot_defined[slot]) {
             return false;
+        }
+
+        this->slot_defined[slot] = false;
+        --this->num_defined;
+
+        // Remove the key from the key table as well.  The slot is reused
+        // by the next key interned, and the new table id invalidates all
+        // cached slots.
+        auto& table = this->key_table.writable();
+        const auto flags = table.flags[slot];
+
+        if ((flags & KeyFlag::Well) != 0) {
+            remove_entry(table.well_slots, slot);
+            this->well_names.reset();
+        }
+
+        if ((flags & KeyFlag::Group) != 0) {
+            remove_entry(table.group_slots, slot);
+            this->group_names.reset();
+        }
+
+        if ((flags & KeyFlag::Conn) != 0) {
+            remove_entry(table.conn_slots, slot);
+        }
+
+        if ((flags & KeyFlag::Segment) != 0) {
+            remove_entry(table.segment_slots, slot);
+        }
+
+        if ((flags & KeyFlag::Region) != 0) {
+            remove_entry(table.region_slots, slot);
+        }
+
+        table.index.erase(table.keys[slot]);
+        table.keys[slot] = std::string{};
+        table.flags[slot] = 0;
+        table.free_slots.push_back(slot);
+        table.id = next_key_table_id();
 
-        erase_var(this->well_values, this->m_wells, var, well);
-        this->well_names.reset();
         return true;
     }
 
-    bool SummaryState::erase_group_var(const std::string& group, const std::string& var)
+    std::unordered_map<std::string, double>
+    SummaryState::general_values() const
     {
-        std::string key = var + ":" + group;
-        if (!this->erase(key))
-            return false;
+        return { this->begin(), this->end() };
+    }
 
-        erase_var(this->group_values, this->m_groups, var, group);
+    SummaryState::VariableValues SummaryState::variable_values() const
+    {
+        auto value = [this](const slot_type slot) -> std::optional<double>
+        {
+            if (! this->slot_defined[slot]) {
+                return std::nullopt;
+            }
+
+            return this->slot_values[slot];
+        };
+
+        auto variables = VariableValues{};
+
+        collect_values(this->key_table->well_slots, variables.well, value);
+        collect_values(this->key_table->group_slots, variables.group, value);
+        collect_values(this->key_table->conn_slots, variables.conn, value);
+        collect_values(this->key_table->segment_slots, variables.segment, value);
+        collect_values(this->key_table->region_slots, variables.region, value);
+
+        return variables;
+    }
+
+    void SummaryState::assign_values(const std::unordered_map<std::string, double>& general,
+                                     const VariableValues&                          variables)
+    {
+        this->key_table = KeyTableRef{};
+
+        this->slot_values.clear();
+        this->slot_defined.clear();
+        this->num_defined = 0;
+        this->well_names.reset();
         this->group_names.reset();
-        return true;
+
+        for (const auto& [key, value] : general) {
+            this->set_slot(this->intern(key), value);
+        }
+
+        for (const auto& [var, wells] : variables.well) {
+            for (const auto& [well, value] : wells) {
+                this->set_slot(this->well_var_slot(well, var), value);
+            }
+        }
+
+        for (const auto& [var, groups] : variables.group) {
+            for (const auto& [group, value] : groups) {
+                this->set_slot(this->group_var_slot(group, var), value);
+            }
+        }
+
+        for (const auto& [var, wells] : variables.conn) {
+            for (const auto& [well, conns] : wells) {
+                for (const auto& [global_index, value] : conns) {
+                    this->set_slot(this->conn_var_slot(well, var, global_index), value);
+                }
+            }
+        }
+
+        for (const auto& [var, wells] : variables.segment) {
+            for (const auto& [well, segments] : wells) {
+                for (const auto& [segment, value] : segments) {
+                    this->set_slot(this->segment_var_slot(well, var, segment), value);
+                }
+            }
+        }
+
+        for (const auto& [var, regSets] : variables.region) {
+            for (const auto& [regSet, regions] : regSets) {
+                for (const auto& [region, value] : regions) {
+                    this->set_slot(this->region_var_slot(regSet, var, region), value);
+                }
+            }
+        }
+    }
+
+    void SummaryState::set(const std::string& key, double value)
+    {
+        this->set_slot(this->intern(key), value);
+    }
+
+    bool SummaryState::erase(const std::string& key)
+    {
+        const auto slot = this->find_slot(key);
+
+        return slot.has_value() && this->remove_slot(*slot);
+    }
+
+    bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
+    {
+        const auto* slot = find_entry(this->key_table->well_slots, var, well);
+
+        return (slot != nullptr) && this->remove_slot(*slot);
+    }
+
+    bool SummaryState::erase_group_var(const std::string& group, const std::string& var)
+    {
+        const auto* slot = find_entry(this->key_table->group_slots, var, group);
+
+        return (slot != nullptr) && this->remove_slot(*slot);
     }
 
     bool SummaryState::has(const std::string& key) const
     {
-        return (this->values.find(key) != this->values.end()) || is_udq(key);
+        const auto slot = this->find_slot(key);
+
+        return (slot.has_value() && this->slot_defined[*slot]) || is_udq(key);
     }
 
     bool SummaryState::has_well_var(const std::string& well,
                                     const std::string& var) const
     {
-        return has_var(this->well_values, var, well)
+        return this->is_defined(find_entry(this->key_table->well_slots, var, well))
             || is_well_udq(var);
     }
 
     bool SummaryState::has_well_var(const std::string& var) const
     {
-        return (this->well_values.count(var) != 0) || is_well_udq(var);
+        const auto* wells = find_entry(this->key_table->well_slots, var);
+
+        return ((wells != nullptr) &&
+                std::any_of(wells->begin(), wells->end(),
+                            [this](const auto& well)
+                            { return this->slot_defined[well.second]; }))
+            || is_well_udq(var);
     }
 
     bool SummaryState::has_group_var(const std::string& group,
                                      const std::string& var) const
     {
-        return has_var(this->group_values, var, group) || is_group_udq(var);
+        return this->is_defined(find_entry(this->key_table->group_slots, var, group))
+            || is_group_udq(var);
     }
 
     bool SummaryState::has_group_var(const std::string& var) const
     {
-        return (this->group_values.count(var) != 0) || is_group_udq(var);
+        const auto* groups = find_entry(this->key_table->group_slots, var);
+
+        return ((groups != nullptr) &&
+                std::any_of(groups->begin(), groups->end(),
+                            [this](const auto& group)
+                            { return this->slot_defined[group.second]; }))
+            || is_group_udq(var);
     }
 
     bool SummaryState::has_conn_var(const std::string& well,
                                     const std::string& var,
                                     const std::size_t  global_index) const
     {
-        // Connection Values = [var][well][index] -> double
-
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
-            return false;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return false;
-        }
-
-        return wellPos->second.find(global_index) != wellPos->second.end();
+        return this->is_defined(find_entry(this->key_table->conn_slots,
+                                           var, well, global_index));
     }
 
     bool SummaryState::has_segment_var(const std::string& well,
                                        const std::string& var,
                                        const std::size_t  segment) const
     {
-        // Segment Values = [var][well][segment] -> double
-
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            return false;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto* segments = find_entry(this->key_table->segment_slots, var, well);
+        if (segments == nullptr) {
             return false;
         }
 
-        return (wellPos->second.find(segment) != wellPos->second.end())
+        return this->is_defined(find_entry(*segments, segment))
             || is_segment_udq(var);
     }
 
@@ -324,73 +868,29 @@ namespace Opm
                                       const std::string& var,
                                       const std::size_t  region) const
     {
-        // Region Values = [var][regSet][region] -> double
-
-        auto varPos = this->region_values.find(EclIO::SummaryNode::normalise_region_keyword(var));
-        if (varPos == this->region_values.end()) {
-            return false;
-        }
-
-        auto regSetPos = varPos->second.find(normalise_region_set_name(regSet));
-        if (regSetPos == varPos->second.end()) {
-            return false;
-        }
-
-        return regSetPos->second.find(region) != regSetPos->second.end();
+        return this->is_defined(find_entry(this->key_table->region_slots,
+                                           EclIO::SummaryNode::normalise_region_keyword(var),
+                                           normalise_region_set_name(regSet),
+                                           region));
     }
 
     void SummaryState::update(const std::string& key, double value)
     {
-        auto& val_ref = this->values[key];
-
-        if (is_total(key)) {
-            val_ref += value;
-        }
-        else {
-            val_ref = value;
-        }
+        this->update_slot(this->intern(key), value);
     }
 
     void SummaryState::update_well_var(const std::string& well,
                                        const std::string& var,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, well)];
-        auto& wval_ref = this->well_values[var][well];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            wval_ref += value;
-        }
-        else {
-            val_ref = wval_ref = value;
-        }
-
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
-            this->well_names.reset();
-        }
+        this->update_slot(this->well_var_slot(well, var), value);
     }
 
     void SummaryState::update_group_var(const std::string& group,
                                         const std::string& var,
                                         const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, group)];
-        auto& gval_ref = this->group_values[var][group];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            gval_ref += value;
-        }
-        else {
-            val_ref = gval_ref = value;
-        }
-
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
-            this->group_names.reset();
-        }
+        this->update_slot(this->group_var_slot(group, var), value);
     }
 
     void SummaryState::update_elapsed(double delta)
@@ -430,16 +930,7 @@ namespace Opm
                                        const std::size_t  global_index,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, global_index)];
-        auto& cval_ref = this->conn_values[var][well][global_index];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            cval_ref += value;
-        }
-        else {
-            val_ref = cval_ref = value;
-        }
+        this->update_slot(this->conn_var_slot(well, var, global_index), value);
     }
 
     void SummaryState::update_segment_var(const std::string& well,
@@ -447,16 +938,7 @@ namespace Opm
                                           const std::size_t  segment,
                                           const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, segment)];
-        auto& sval_ref = this->segment_values[var][well][segment];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            sval_ref += value;
-        }
-        else {
-            val_ref = sval_ref = value;
-        }
+        this->update_slot(this->segment_var_slot(well, var, segment), value);
     }
 
     void SummaryState::update_region_var(const std::string& regSet,
@@ -464,25 +946,15 @@ namespace Opm
                                          const std::size_t  region,
                                          const double       value)
     {
-        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
-
-        auto& val_ref  = this->values[region_key(regKw, regSet, region)];
-        auto& rval_ref = this->region_values[regKw][normalise_region_set_name(regSet)][region];
-
-        if (is_total(regKw)) {
-            val_ref  += value;
-            rval_ref += value;
-        }
-        else {
-            val_ref = rval_ref = value;
-        }
+        this->update_slot(this->region_var_slot(regSet, var, region), value);
     }
 
     double SummaryState::get(const std::string& key) const
     {
-        auto iter = this->values.find(key);
-        if (iter != this->values.end()) {
-            return iter->second;
+        if (const auto slot = this->find_slot(key);
+            slot.has_value() && this->slot_defined[*slot])
+        {
+            return this->slot_values[*slot];
         }
 
         if (is_udq(key)) {
@@ -497,9 +969,10 @@ namespace Opm
     double SummaryState::get(const std::string& key,
                              const double       default_value) const
     {
-        auto iter = this->values.find(key);
-        if (iter != this->values.end()) {
-            return iter->second;
+        if (const auto slot = this->find_slot(key);
+            slot.has_value() && this->slot_defined[*slot])
+        {
+            return this->slot_values[*slot];
         }
 
         if (is_udq(key)) {
@@ -519,8 +992,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_well_udq(var);
 
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
+        const auto* wells = find_entry(this->key_table->well_slots, var);
+        if (wells == nullptr) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -531,8 +1004,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto* slot = find_entry(*wells, well);
+        if (! this->is_defined(slot)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -544,7 +1017,7 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return wellPos->second;
+        return this->slot_values[*slot];
     }
 
     double SummaryState::get_group_var(const std::string& group,
@@ -552,8 +1025,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_group_udq(var);
 
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
+        const auto* groups = find_entry(this->key_table->group_slots, var);
+        if (groups == nullptr) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -564,8 +1037,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto groupPos = varPos->second.find(group);
-        if (groupPos == varPos->second.end()) {
+        const auto* slot = find_entry(*groups, group);
+        if (! this->is_defined(slot)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -577,23 +1050,23 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return groupPos->second;
+        return this->slot_values[*slot];
     }
 
     double SummaryState::get_conn_var(const std::string& well,
                                       const std::string& var,
                                       const std::size_t  global_index) const
     {
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
+        const auto* wells = find_entry(this->key_table->conn_slots, var);
+        if (wells == nullptr) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the connection level", var)
             };
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto* conns = find_entry(*wells, well);
+        if (conns == nullptr) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the connection "
@@ -602,8 +1075,8 @@ namespace Opm
             };
         }
 
-        auto connPos = wellPos->second.find(global_index);
-        if (connPos == wellPos->second.end()) {
+        const auto* slot = find_entry(*conns, global_index);
+        if (! this->is_defined(slot)) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist for connection {} "
@@ -612,7 +1085,7 @@ namespace Opm
             };
         }
 
-        return connPos->second;
+        return this->slot_values[*slot];
     }
 
     double SummaryState::get_segment_var(const std::string& well,
@@ -621,8 +1094,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_segment_udq(var);
 
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
+        const auto* wells = find_entry(this->key_table->segment_slots, var);
+        if (wells == nullptr) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -633,8 +1106,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto* segments = find_entry(*wells, well);
+        if (segments == nullptr) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -647,8 +1120,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto segPos = wellPos->second.find(segment);
-        if (segPos == wellPos->second.end()) {
+        const auto* slot = find_entry(*segments, segment);
+        if (! this->is_defined(slot)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -661,23 +1134,24 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return segPos->second;
+        return this->slot_values[*slot];
     }
 
     double SummaryState::get_region_var(const std::string& regSet,
                                         const std::string& var,
                                         const std::size_t  region) const
     {
-        auto varPos = this->region_values.find(EclIO::SummaryNode::normalise_region_keyword(var));
-        if (varPos == this->region_values.end()) {
+        const auto* regSets = find_entry(this->key_table->region_slots,
+                                         EclIO::SummaryNode::normalise_region_keyword(var));
+        if (regSets == nullptr) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the region level", var)
             };
         }
 
-        auto regSetPos = varPos->second.find(normalise_region_set_name(regSet));
-        if (regSetPos == varPos->second.end()) {
+        const auto* regions = find_entry(*regSets, normalise_region_set_name(regSet));
+        if (regions == nullptr) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the region "
@@ -686,8 +1160,8 @@ namespace Opm
             };
         }
 
-        auto regionPos = regSetPos->second.find(region);
-        if (regionPos == regSetPos->second.end()) {
+        const auto* slot = find_entry(*regions, region);
+        if (! this->is_defined(slot)) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist for region {} "
@@ -696,45 +1170,31 @@ namespace Opm
             };
         }
 
-        return regionPos->second;
+        return this->slot_values[*slot];
     }
 
     double SummaryState::get_well_var(const std::string& well,
                                       const std::string& var,
                                       const double       default_value) const
     {
-        const auto fallback = is_well_udq(var)
-            ? this->udq_undefined
-            : default_value;
-
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
-            return fallback;
+        const auto* slot = find_entry(this->key_table->well_slots, var, well);
+        if (this->is_defined(slot)) {
+            return this->slot_values[*slot];
         }
 
-        auto wellPos = varPos->second.find(well);
-        return (wellPos == varPos->second.end())
-            ? fallback
-            : wellPos->second;
+        return is_well_udq(var) ? this->udq_undefined : default_value;
     }
 
     double SummaryState::get_group_var(const std::string& group,
                                        const std::string& var,
                                        const double       default_value) const
     {
-        const auto fallback = is_group_udq(var)
-            ? this->udq_undefined
-            : default_value;
-
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
-            return fallback;
+        const auto* slot = find_entry(this->key_table->group_slots, var, group);
+        if (this->is_defined(slot)) {
+            return this->slot_values[*slot];
         }
 
-        auto groupPos = varPos->second.find(group);
-        return (groupPos == varPos->second.end())
-            ? fallback
-            : groupPos->second;
+        return is_group_udq(var) ? this->udq_undefined : default_value;
     }
 
     double SummaryState::get_conn_var(const std::string& well,
@@ -742,20 +1202,11 @@ namespace Opm
                                       const std::size_t  global_index,
                                       const double       default_value) const
     {
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
-            return default_value;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
-        }
+        const auto* slot = find_entry(this->key_table->conn_slots, var, well, global_index);
 
-        auto connPos = wellPos->second.find(global_index);
-        return (connPos == wellPos->second.end())
-            ? default_value
-            : connPos->second;
+        return this->is_defined(slot)
+            ? this->slot_values[*slot]
+            : default_value;
     }
 
     double SummaryState::get_segment_var(const std::string& well,
@@ -763,26 +1214,35 @@ namespace Opm
                                          const std::size_t  segment,
                                          const double       default_value) const
     {
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            return default_value;
-        }
+        const auto* slot = find_entry(this->key_table->segment_slots, var, well, segment);
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
-        }
+        return this->is_defined(slot)
+            ? this->slot_values[*slot]
+            : default_value;
+    }
 
-        auto valPos = wellPos->second.find(segment);
-        return (valPos == wellPos->second.end())
-            ? default_value
-            : valPos->second;
+    double SummaryState::get_region_var(const std::string& regSet,
+                                        const std::string& var,
+                                        const std::size_t  region,
+                                        const double       default_value) const
+    {
+        const auto* slot = find_entry(this->key_table->region_slots,
+                                      EclIO::SummaryNode::normalise_region_keyword(var),
+                                      normalise_region_set_name(regSet),
+                                      region);
+
+        return this->is_defined(slot)
+            ? this->slot_values[*slot]
+            : default_value;
     }
 
     const std::vector<std::string>& SummaryState::wells() const
     {
         if (!this->well_names.has_value()) {
-            this->well_names.emplace(this->m_wells.begin(), this->m_wells.end());
+            this->well_names.emplace
+                (defined_names(this->key_table->well_slots,
+                               [this](const slot_type slot)
+                               { return this->slot_defined[slot]; }));
         }
 
         return *this->well_names;
@@ -790,13 +1250,28 @@ namespace Opm
 
     std::vector<std::string> SummaryState::wells(const std::string& var) const
     {
-        return var2_list(this->well_values, var);
+        auto names = std::vector<std::string>{};
+
+        if (const auto* wells = find_entry(this->key_table->well_slots, var);
+            wells != nullptr)
+        {
+            for (const auto& [well, slot] : *wells) {
+                if (this->slot_defined[slot]) {
+                    names.push_back(well);
+                }
+            }
+        }
+
+        return names;
     }
 
     const std::vector<std::string>& SummaryState::groups() const
     {
         if (!this->group_names.has_value()) {
-            this->group_names.emplace(this->m_groups.begin(), this->m_groups.end());
+            this->group_names.emplace
+                (defined_names(this->key_table->group_slots,
+                               [this](const slot_type slot)
+                               { return this->slot_defined[slot]; }));
         }
 
         return *this->group_names;
@@ -804,54 +1279,98 @@ namespace Opm
 
     std::vector<std::string> SummaryState::groups(const std::string& var) const
     {
-        return var2_list(this->group_values, var);
+        auto names = std::vector<std::string>{};
+
+        if (const auto* groups = find_entry(this->key_table->group_slots, var);
+            groups != nullptr)
+        {
+            for (const auto& [group, slot] : *groups) {
+                if (this->slot_defined[slot]) {
+                    names.push_back(group);
+                }
+            }
+        }
+
+        return names;
     }
 
     void SummaryState::append(const SummaryState& buffer)
     {
+        // The buffer's values replace ours, except for the well, group,
+        // connection and segment variables which the buffer does not have
+        // at all.  Those are kept.
+        auto kept = this->variable_values();
+        const auto other = buffer.variable_values();
+
+        auto drop_known = [](auto& values, const auto& known)
+        {
+            for (const auto& var : known) {
+                values.erase(var.first);
+            }
+        };
+
+        drop_known(kept.well, other.well);
+        drop_known(kept.group, other.group);
+        drop_known(kept.conn, other.conn);
+        drop_known(kept.segment, other.segment);
+        kept.region.clear();
+
         this->sim_start = buffer.sim_start;
         this->elapsed = buffer.elapsed;
-        this->values = buffer.values;
+        this->key_table = buffer.key_table;
+        this->slot_values = buffer.slot_values;
+        this->slot_defined = buffer.slot_defined;
+        this->num_defined = buffer.num_defined;
         this->well_names.reset();
         this->group_names.reset();
 
-        this->m_wells.insert(buffer.m_wells.begin(), buffer.m_wells.end());
-        for (const auto& [var, vals] : buffer.well_values) {
-            this->well_values.insert_or_assign(var, vals);
+        for (const auto& [var, wells] : kept.well) {
+            for (const auto& [well, value] : wells) {
+                this->set_slot(this->well_var_slot(well, var), value);
+            }
         }
 
-        this->m_groups.insert(buffer.m_groups.begin(), buffer.m_groups.end());
-        for (const auto& [var, vals] : buffer.group_values) {
-            this->group_values.insert_or_assign(var, vals);
+        for (const auto& [var, groups] : kept.group) {
+            for (const auto& [group, value] : groups) {
+                this->set_slot(this->group_var_slot(group, var), value);
+            }
         }
 
-        for (const auto& [var, vals] : buffer.conn_values) {
-            this->conn_values.insert_or_assign(var, vals);
+        for (const auto& [var, wells] : kept.conn) {
+            for (const auto& [well, conns] : wells) {
+                for (const auto& [global_index, value] : conns) {
+                    this->set_slot(this->conn_var_slot(well, var, global_index), value);
+                }
+            }
         }
 
-        for (const auto& [var, vals] : buffer.segment_values) {
-            this->segment_values.insert_or_assign(var, vals);
+        for (const auto& [var, wells] : kept.segment) {
+            for (const auto& [well, segments] : wells) {
+                for (const auto& [segment, value] : segments) {
+                    this->set_slot(this->segment_var_slot(well, var, segment), value);
+                }
+            }
         }
     }
 
     SummaryState::const_iterator SummaryState::begin() const
     {
-        return this->values.begin();
+        return { this, 0 };
     }
 
     SummaryState::const_iterator SummaryState::end() const
     {
-        return this->values.end();
+        return { this, this->slot_values.size() };
     }
 
     std::size_t SummaryState::num_wells() const
     {
-        return this->m_wells.size();
+        return this->wells().size();
     }
 
     std::size_t SummaryState::size() const
     {
-        return this->values.size();
+        return this->num_defined;
     }
 
     bool SummaryState::operator==(const SummaryState& other) const
@@ -859,16 +1378,16 @@ namespace Opm
         return (this->sim_start == other.sim_start)
             && (this->udq_undefined == other.udq_undefined)
             && (this->elapsed == other.elapsed)
-            && (this->values == other.values)
-            && (this->well_values == other.well_values)
-            && (this->m_wells == other.m_wells)
-            && (this->wells() == other.wells())
-            && (this->group_values == other.group_values)
-            && (this->m_groups == other.m_groups)
-            && (this->groups() == other.groups())
-            && (this->conn_values == other.conn_values)
-            && (this->segment_values == other.segment_values)
-            && (this->region_values == other.region_values)
+            && (this->size() == other.size())
+            && std::all_of(this->begin(), this->end(),
+                           [&other](const auto& value_pair)
+                           {
+                               const auto slot = other.find_slot(value_pair.first);
+                               return slot.has_value()
+                                   && other.slot_defined[*slot]
+                                   && (other.slot_values[*slot] == value_pair.second);
+                           })
+            && (this->variable_values() == other.variable_values())
             ;
     }
 
@@ -877,49 +1396,24 @@ namespace Opm
         auto st = SummaryState{TimeService::from_time_t(101), 1.234};
 
         st.elapsed = 1.0;
-        st.values = {{"test1", 2.0}};
-        st.well_values = {{"test2", {{"test3", 3.0}}}};
-        st.m_wells = {"test4"};
-        st.well_names = {"test5"};
-        st.group_values = {{"test6", {{"test7", 4.0}}}},
-        st.m_groups = {"test7"};
-        st.group_names = {"test8"},
-        st.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
+        st.set("test1", 2.0);
+        st.set_slot(st.well_var_slot("test3", "test2"), 3.0);
+        st.set_slot(st.group_var_slot("test7", "test6"), 4.0);
+        st.set_slot(st.conn_var_slot("test10", "test9", 5), 6.0);
 
-        {
-            auto& sval = st.segment_values["SU1"];
-            sval.emplace("W1", std::unordered_map<std::size_t, double> {
-                    { std::size_t{ 1},  123.456   },
-                    { std::size_t{ 2},   17.29    },
-                    { std::size_t{10}, -  2.71828 },
-                });
+        st.set_slot(st.segment_var_slot("W1", "SU1",  1), 123.456);
+        st.set_slot(st.segment_var_slot("W1", "SU1",  2), 17.29);
+        st.set_slot(st.segment_var_slot("W1", "SU1", 10), - 2.71828);
+        st.set_slot(st.segment_var_slot("W6", "SU1",  7), 3.1415926535);
 
-            sval.emplace("W6", std::unordered_map<std::size_t, double> {
-                    { std::size_t{ 7}, 3.1415926535 },
-                });
-        }
+        st.set_slot(st.segment_var_slot("I2", "SUVIS", 17), 29.0);
+        st.set_slot(st.segment_var_slot("I2", "SUVIS", 42), - 1.618);
 
-        {
-            auto& sval = st.segment_values["SUVIS"];
-            sval.emplace("I2", std::unordered_map<std::size_t, double> {
-                    { std::size_t{17},  29.0   },
-                    { std::size_t{42}, - 1.618 },
-                });
-        }
+        st.set_slot(st.region_var_slot("FIPNUM", "ROPT", 12), 34.56);
+        st.set_slot(st.region_var_slot("FIPNUM", "ROPT",  3), 14.15926);
 
-        {
-            auto& rval = st.region_values["ROPT"]["NUM"];
-            rval.emplace(12, 34.56);
-            rval.emplace(3,  14.15926);
-        }
-
-        {
-            auto& rval = st.region_values["RGPR"];
-            rval.try_emplace("RE2", std::unordered_map<std::size_t, double> {
-                    { std::size_t{17},  29.0   },
-                    { std::size_t{42}, - 1.618 },
-                });
-        }
+        st.set_slot(st.region_var_slot("FIPRE2", "RGPR", 17), 29.0);
+        st.set_slot(st.region_var_slot("FIPRE2", "RGPR", 42), - 1.618);
 
         return st;
     }
@@ -22,13 +22,18 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <iosfwd>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -47,8 +52,8 @@ class UDQSet;
 // well 'OPX'.  The main usage of the SummaryState class is a temporary
 // holding ground while assembling data for the summary output, but it is
 // also used as a context object when evaulating the condition in ACTIONX
-// keywords. For that reason some of the data is duplicated both in the
-// general structure and a specialized structure:
+// keywords. For that reason some of the data is also available through a
+// specialized structure:
 //
 //     SummaryState st { start, udqUndefined };
 //
@@ -65,13 +70,71 @@ class UDQSet;
 //     // accessible through the specialized st.has_well_var("OPY", "WGOR").
 //     st.has("WGOR:OPY") => True
 //     st.has_well_var("OPY", "WGOR") => False
+//
+// The values accessible through the general string keys are stored in a
+// dense array.  Every key is interned on first use and is assigned a slot.
+// The values of the specialized structures live in the same array, so
+// has_well_var("OPX", "WWCT") and has("WWCT:OPX") always agree once the
+// variable has been added with add_well_var().  Code which accesses the
+// same keys repeatedly, like the summary output, should look up the slots
+// once and use the slot based accessors:
+//
+//     const auto slot = st.intern("FOPR");
+//     st.update_slot(slot, 123.4);
+//     st.has_slot(slot) => True
+//     st.get_slot(slot) => 123.4
+//
+// A key table id identifies a particular key to slot mapping.  The id
+// changes whenever a key is interned, registered as a specialized variable,
+// or removed by erase(), so cached slots can be validated by comparing
+// key_table_id() to the id seen when the slots were looked up.
 
 namespace Opm {
 
 class SummaryState
 {
 public:
-    using const_iterator = std::unordered_map<std::string, double>::const_iterator;
+    using slot_type = std::size_t;
+
+    // Iterates over the defined (key, value) pairs of the general store.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = std::pair<const std::string&, double>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = value_type;
+
+        struct pointer
+        {
+            value_type value;
+            const value_type* operator->() const { return &value; }
+        };
+
+        const_iterator(const SummaryState* st, slot_type slot);
+
+        reference operator*() const;
+        pointer operator->() const { return { **this }; }
+
+        const_iterator& operator++();
+        const_iterator operator++(int);
+
+        bool operator==(const const_iterator& that) const
+        {
+            return (this->st_ == that.st_) && (this->slot_ == that.slot_);
+        }
+
+        bool operator!=(const const_iterator& that) const
+        {
+            return !(*this == that);
+        }
+
+    private:
+        const SummaryState* st_{nullptr};
+        slot_type slot_{0};
+
+        void skipUndefined();
+    };
 
     explicit SummaryState(time_point sim_start_arg, double udqUndefined);
 
@@ -127,6 +190,32 @@ public:
 
     bool is_undefined_value(const double val) const { return val == udq_undefined; }
 
+    // Slot based access to the general store.  intern() returns the slot
+    // of key, adding it to the key table if needed, but does not define a
+    // value.  find_slot() does not modify the key table.
+    slot_type intern(const std::string& key);
+    std::vector<slot_type> intern(const std::vector<std::string>& keys);
+    std::optional<slot_type> find_slot(const std::string& key) const;
+    const std::string& slot_key(slot_type slot) const;
+    std::size_t num_slots() const;
+    std::uint64_t key_table_id() const;
+
+    bool has_slot(slot_type slot) const;
+    double get_slot(slot_type slot) const;
+    double get_slot(slot_type slot, double default_value) const;
+    void set_slot(slot_type slot, double value);
+    void update_slot(slot_type slot, double value);
+
+    // Slots of the variables in the specialized structures.  The key is
+    // interned and registered as a well, group, connection, segment or
+    // region variable, but no value is defined.  Storing a value in the
+    // slot is equivalent to the corresponding update_xxx_var() call.
+    slot_type well_var_slot(const std::string& well, const std::string& var);
+    slot_type group_var_slot(const std::string& group, const std::string& var);
+    slot_type conn_var_slot(const std::string& well, const std::string& var, std::size_t global_index);
+    slot_type segment_var_slot(const std::string& well, const std::string& var, std::size_t segment);
+    slot_type region_var_slot(const std::string& regSet, const std::string& var, std::size_t region);
+
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     const std::vector<std::string>& groups() const;
@@ -144,16 +233,20 @@ public:
         serializer(sim_start);
         serializer(this->udq_undefined);
         serializer(elapsed);
-        serializer(values);
-        serializer(well_values);
-        serializer(m_wells);
-        serializer(well_names);
-        serializer(group_values);
-        serializer(m_groups);
-        serializer(group_names);
-        serializer(conn_values);
-        serializer(segment_values);
-        serializer(this->region_values);
+
+        // Values are serialized as plain maps so that the serialized form
+        // is independent of the interning order.
+        auto general = std::unordered_map<std::string, double>{};
+        auto variables = VariableValues{};
+        if (serializer.isSerializing()) {
+            general = this->general_values();
+            variables = this->variable_values();
+        }
+        serializer(general);
+        serializer(variables);
+        if (! serializer.isSerializing()) {
+            this->assign_values(general, variables);
+        }
     }
 
     static SummaryState serializationTestObject();
@@ -162,29 +255,102 @@ private:
     time_point sim_start;
     double udq_undefined{};
     double elapsed = 0;
-    std::unordered_map<std::string,double> values;
 
-    // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
-    std::set<std::string> m_wells;
-    mutable std::optional<std::vector<std::string>> well_names;
+    template <class T>
+    using NameMap = std::unordered_map<std::string, T>;
 
-    // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
-    std::set<std::string> m_groups;
-    mutable std::optional<std::vector<std::string>> group_names;
+    template <class T>
+    using NumberMap = std::unordered_map<std::size_t, T>;
 
-    // The first key is the variable and the second key is the well and the
-    // third is the global index. NB: The global_index has offset 1!
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> conn_values;
+    // Interned keys.  The slots of the specialized variables are kept in
+    // nested maps.  The first key is the variable, the second is the well,
+    // group or region set, and the third is the one-based connection
+    // (global index), segment or region number.
+    struct KeyTable
+    {
+        std::uint64_t id{};
+        std::unordered_map<std::string, slot_type> index{};
+        std::vector<std::string> keys{};
+        std::vector<unsigned char> flags{}; // KeyFlag bits
+        std::vector<slot_type> free_slots{};
+
+        NameMap<NameMap<slot_type>> well_slots{};
+        NameMap<NameMap<slot_type>> group_slots{};
+        NameMap<NameMap<NumberMap<slot_type>>> conn_slots{};
+        NameMap<NameMap<NumberMap<slot_type>>> segment_slots{};
+        NameMap<NameMap<NumberMap<slot_type>>> region_slots{};
+    };
+
+    // Key table which may be shared with copies of the object.  Copying
+    // marks both the source and the copy as sharing the table, and a
+    // shared table is never modified again but cloned first.  Unlike the
+    // shared_ptr use count the mark does not depend on when the other
+    // copies are destroyed, so a table is never modified while a copy on
+    // another thread may still read it.
+    class KeyTableRef
+    {
+    public:
+        KeyTableRef();
+        KeyTableRef(const KeyTableRef& rhs);
+        KeyTableRef(KeyTableRef&& rhs) noexcept;
+        KeyTableRef& operator=(const KeyTableRef& rhs);
+        KeyTableRef& operator=(KeyTableRef&& rhs) noexcept;
+
+        const KeyTable& operator*() const { return *this->table_; }
+        const KeyTable* operator->() const { return this->table_.get(); }
+
+        // Table which may be modified.  Cloned first if shared.
+        KeyTable& writable();
+
+    private:
+        std::shared_ptr<KeyTable> table_;
+        mutable std::atomic<bool> shared_{false};
+    };
+
+    // Values of the specialized variables, in the form used for
+    // serialization and comparison.
+    struct VariableValues
+    {
+        NameMap<NameMap<double>> well{};
+        NameMap<NameMap<double>> group{};
+        NameMap<NameMap<NumberMap<double>>> conn{};
+        NameMap<NameMap<NumberMap<double>>> segment{};
+        NameMap<NameMap<NumberMap<double>>> region{};
+
+        bool operator==(const VariableValues& that) const;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(well);
+            serializer(group);
+            serializer(conn);
+            serializer(segment);
+            serializer(region);
+        }
+    };
+
+    KeyTableRef key_table{};
+
+    // Value and definedness of each slot.
+    std::vector<double> slot_values{};
+    std::vector<bool> slot_defined{};
+    std::size_t num_defined{0};
+
+    // Sorted names of the wells and groups with at least one defined
+    // variable.  Reset when the definedness of such a variable changes.
+    mutable std::optional<std::vector<std::string>> well_names;
+    mutable std::optional<std::vector<std::string>> group_names;
 
-    // The first key is the variable and the second key is the well and the
-    // third is the one-based segment number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> segment_values;
+    bool is_defined(const slot_type* slot) const;
+    void define_slot(slot_type slot);
+    void register_slot(KeyTable& table, slot_type slot, unsigned char kind);
+    bool remove_slot(slot_type slot);
 
-    // First key is variable (e.g., ROIP), second key is region set (e.g.,
-    // FIPNUM, FIPABC), and the third key is the one-based region number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> region_values;
+    std::unordered_map<std::string, double> general_values() const;
+    VariableValues variable_values() const;
+    void assign_values(const std::unordered_map<std::string, double>& general,
+                       const VariableValues& variables);
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
@@ -0,0 +1,176 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ByteSwap.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define OPM_ECLIO_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+    std::uint32_t swap(std::uint32_t v)
+    {
+#ifdef _MSC_VER
+        return _byteswap_ulong(v);
+#else
+        return __builtin_bswap32(v);
+#endif
+    }
+
+    std::uint64_t swap(std::uint64_t v)
+    {
+#ifdef _MSC_VER
+        return _byteswap_uint64(v);
+#else
+        return __builtin_bswap64(v);
+#endif
+    }
+
+    template <typename Word>
+    void swapScalar(const char* src, char* dst, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i) {
+            Word w;
+            std::memcpy(&w, src + i*sizeof(Word), sizeof(Word));
+            w = swap(w);
+            std::memcpy(dst + i*sizeof(Word), &w, sizeof(Word));
+        }
+    }
+
+#ifdef OPM_ECLIO_X86_KERNELS
+
+    // Byte shuffle masks.  PSHUFB operates within 128-bit lanes, so the
+    // AVX2 masks repeat the SSE pattern in both lanes.
+
+    __attribute__((target("ssse3")))
+    __m128i mask128(std::size_t wordSize)
+    {
+        return (wordSize == 4)
+            ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+            : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    }
+
+    template <typename Word>
+    __attribute__((target("ssse3")))
+    void swapSSSE3(const char* src, char* dst, std::size_t n)
+    {
+        constexpr std::size_t perVector = sizeof(__m128i) / sizeof(Word);
+        const __m128i mask = mask128(sizeof(Word));
+
+        std::size_t i = 0;
+        for (; i + perVector <= n; i += perVector) {
+            const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i*sizeof(Word)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*sizeof(Word)), _mm_shuffle_epi8(v, mask));
+        }
+
+        swapScalar<Word>(src + i*sizeof(Word), dst + i*sizeof(Word), n - i);
+    }
+
+    template <typename Word>
+    __attribute__((target("avx2")))
+    void swapAVX2(const char* src, char* dst, std::size_t n)
+    {
+        constexpr std::size_t perVector = sizeof(__m256i) / sizeof(Word);
+        const __m256i mask = (sizeof(Word) == 4)
+            ? _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                               3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+            : _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                               7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+        std::size_t i = 0;
+
+        // two vectors per iteration to hide shuffle latency
+        for (; i + 2*perVector <= n; i += 2*perVector) {
+            const auto* s = reinterpret_cast<const __m256i*>(src + i*sizeof(Word));
+            auto* d = reinterpret_cast<__m256i*>(dst + i*sizeof(Word));
+
+            const auto v0 = _mm256_loadu_si256(s);
+            const auto v1 = _mm256_loadu_si256(s + 1);
+            _mm256_storeu_si256(d, _mm256_shuffle_epi8(v0, mask));
+            _mm256_storeu_si256(d + 1, _mm256_shuffle_epi8(v1, mask));
+        }
+
+        for (; i + perVector <= n; i += perVector) {
+            const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i*sizeof(Word)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i*sizeof(Word)), _mm256_shuffle_epi8(v, mask));
+        }
+
+        swapScalar<Word>(src + i*sizeof(Word), dst + i*sizeof(Word), n - i);
+    }
+
+#endif // OPM_ECLIO_X86_KERNELS
+
+    using Kernel = void (*)(const char*, char*, std::size_t);
+
+    struct KernelSet
+    {
+        Kernel swap32;
+        Kernel swap64;
+        std::string_view name;
+    };
+
+    KernelSet selectKernels()
+    {
+#ifdef OPM_ECLIO_X86_KERNELS
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2"))
+            return { &swapAVX2<std::uint32_t>, &swapAVX2<std::uint64_t>, "avx2" };
+
+        if (__builtin_cpu_supports("ssse3"))
+            return { &swapSSSE3<std::uint32_t>, &swapSSSE3<std::uint64_t>, "ssse3" };
+#endif
+
+        return { &swapScalar<std::uint32_t>, &swapScalar<std::uint64_t>, "scalar" };
+    }
+
+    const KernelSet& kernels()
+    {
+        static const KernelSet selected = selectKernels();
+        return selected;
+    }
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+void byteSwap32(const void* src, void* dst, std::size_t n)
+{
+    kernels().swap32(static_cast<const char*>(src), static_cast<char*>(dst), n);
+}
+
+void byteSwap64(const void* src, void* dst, std::size_t n)
+{
+    kernels().swap64(static_cast<const char*>(src), static_cast<char*>(dst), n);
+}
+
+std::string_view byteSwapKernel()
+{
+    return kernels().name;
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,46 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_BYTESWAP_HPP
+#define OPM_IO_BYTESWAP_HPP
+
+#include <cstddef>
+#include <string_view>
+
+namespace Opm { namespace EclIO {
+
+/// Bulk conversion between native and big-endian (on-disk) byte order.
+///
+/// The kernels reverse the byte order of \p n consecutive 32-bit or 64-bit
+/// words read from \p src and store the result in \p dst.  Source and
+/// destination may be the same buffer, for in-place conversion, but must
+/// not overlap otherwise.  Neither buffer needs to be aligned.
+///
+/// The implementation is selected once, at runtime, based on the
+/// instruction sets supported by the CPU: AVX2 or SSSE3 on x86, and a
+/// portable scalar loop everywhere else.
+void byteSwap32(const void* src, void* dst, std::size_t n);
+void byteSwap64(const void* src, void* dst, std::size_t n);
+
+/// Name of the kernel selected at runtime, i.e., one of "avx2", "ssse3" or
+/// "scalar".
+std::string_view byteSwapKernel();
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_BYTESWAP_HPP
@@ -0,0 +1,403 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ColESmry.hpp>
+#include <opm/io/eclipse/ColSmryFormat.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/shmatch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+
+template <typename T>
+bool readAt(std::ifstream& fileH, std::uint64_t pos, T* data, std::size_t n = 1)
+{
+    fileH.seekg(static_cast<std::streamoff>(pos), std::ios_base::beg);
+    fileH.read(reinterpret_cast<char*>(data), n * sizeof(T));
+
+    return static_cast<bool>(fileH);
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+ColESmry::ColESmry(const std::string& filename)
+    : m_inputFileName { filename }
+{
+    auto start = std::chrono::system_clock::now();
+
+    if (m_inputFileName.extension() == "")
+        m_inputFileName += ".CSMRY";
+
+    if (m_inputFileName.extension() != ".CSMRY")
+        throw std::invalid_argument("Input file should have extension .CSMRY");
+
+    // the directory may not yet be complete if the file was just created
+    if (!tryRepeatedly([this]() { return this->open_csmry(); }))
+        OPM_THROW(std::runtime_error, "when opening CSMRY file " + m_inputFileName.string());
+
+    m_vectorData.resize(m_keyword.size(), {});
+    m_vectorLoaded.resize(m_keyword.size(), false);
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_opening += elapsed_seconds.count();
+}
+
+
+bool ColESmry::open_csmry()
+{
+    m_keyword.clear();
+    m_keyword_index.clear();
+    kwunits.clear();
+    m_chunks.clear();
+    m_rstep.clear();
+    m_seqIndex.clear();
+    m_nTstep = 0;
+    m_scanPos = 0;
+    m_haveDirectory = false;
+
+    std::size_t num_new = 0;
+
+    return this->read_records(num_new) && m_haveDirectory;
+}
+
+
+bool ColESmry::read_records(std::size_t& num_new)
+{
+    num_new = 0;
+
+    std::ifstream fileH(m_inputFileName, std::ios::in | std::ios::binary);
+
+    if (!fileH)
+        return false;
+
+    std::error_code ec;
+    const std::uint64_t fileSize = std::filesystem::file_size(m_inputFileName, ec);
+    if (ec)
+        return false;
+
+    if (m_scanPos == 0) {
+        std::array<char, 8> magic;
+        if (!readAt(fileH, 0, magic.data(), magic.size()))
+            return false;
+
+        if (magic != ColSmry::magic)
+            OPM_THROW(std::invalid_argument, "invalid CSMRY file " + m_inputFileName.string());
+
+        m_scanPos = magic.size();
+    }
+
+    const auto firstNewChunk = m_chunks.size();
+    const auto firstNewStep = m_nTstep;
+
+    std::uint64_t pos = m_scanPos;
+
+    while (pos + sizeof(ColSmry::RecordHeader) <= fileSize) {
+        ColSmry::RecordHeader header;
+        std::uint64_t trailer;
+
+        if (!readAt(fileH, pos, &header))
+            break;
+
+        const auto payload = pos + sizeof(header);
+
+        // incomplete trailing record, still being written
+        if ((header.length > fileSize) || (payload + header.length + sizeof(trailer) > fileSize))
+            break;
+
+        if (!readAt(fileH, payload + header.length, &trailer) || (trailer != header.length))
+            break;
+
+        const auto kind = static_cast<ColSmry::RecordKind>(header.kind);
+
+        if ((kind == ColSmry::RecordKind::Directory) && !m_haveDirectory) {
+            std::vector<char> buffer(header.length);
+
+            if (!readAt(fileH, payload, buffer.data(), buffer.size()))
+                break;
+
+            const auto dir = ColSmry::unpackDirectory(buffer.data(), buffer.size());
+
+            m_start_vect = dir.start;
+            m_startdat = summaryStartDate(m_start_vect);
+            m_restart = std::make_tuple(dir.restartRoot, dir.restartStep);
+            m_keyword = dir.keys;
+
+            for (std::size_t n = 0; n < m_keyword.size(); n++) {
+                m_keyword_index[m_keyword[n]] = n;
+                kwunits[m_keyword[n]] = dir.units[n];
+            }
+
+            m_haveDirectory = true;
+        }
+        else if ((kind == ColSmry::RecordKind::Chunk) && m_haveDirectory) {
+            ColSmry::ChunkHeader chunk;
+
+            if ((header.length < sizeof(chunk)) || !readAt(fileH, payload, &chunk))
+                OPM_THROW(std::runtime_error, "invalid chunk in CSMRY file " + m_inputFileName.string());
+
+            if ((chunk.firstStep != m_nTstep) || (chunk.numColumns != m_keyword.size() + 1))
+                OPM_THROW(std::runtime_error, "inconsistent chunk in CSMRY file " + m_inputFileName.string());
+
+            m_chunks.push_back({ payload + sizeof(chunk), chunk.firstStep, chunk.numSteps });
+            m_nTstep += chunk.numSteps;
+        }
+        else {
+            OPM_THROW(std::runtime_error, "unexpected record in CSMRY file " + m_inputFileName.string());
+        }
+
+        pos = payload + header.length + sizeof(trailer);
+    }
+
+    m_scanPos = pos;
+
+    if (!m_haveDirectory)
+        return true;
+
+    // report step column for the new chunks, plus the new part of each
+    // vector loaded so far
+
+    m_rstep.reserve(m_nTstep);
+
+    for (auto c = firstNewChunk; c < m_chunks.size(); ++c) {
+        const auto column = read_column(fileH, m_chunks[c], 0);
+        m_rstep.insert(m_rstep.end(), column.begin(), column.end());
+    }
+
+    for (std::size_t m = firstNewStep; m < m_rstep.size(); m++)
+        if (m_rstep[m] == 1)
+            m_seqIndex.push_back(m);
+
+    for (std::size_t kind = 0; kind < m_vectorLoaded.size(); kind++) {
+        if (!m_vectorLoaded[kind])
+            continue;
+
+        m_vectorData[kind].resize(m_nTstep);
+
+        for (auto c = firstNewChunk; c < m_chunks.size(); ++c) {
+            const auto words = read_column(fileH, m_chunks[c], kind + 1);
+            std::memcpy(m_vectorData[kind].data() + m_chunks[c].firstStep, words.data(),
+                        words.size() * sizeof(float));
+        }
+    }
+
+    num_new = m_nTstep - firstNewStep;
+
+    return true;
+}
+
+
+std::size_t ColESmry::refresh()
+{
+    auto start = std::chrono::system_clock::now();
+
+    std::size_t num_new = 0;
+
+    if (!tryRepeatedly([this, &num_new]() { return this->read_records(num_new); }))
+        OPM_THROW(std::runtime_error, "when refreshing CSMRY file " + m_inputFileName.string());
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+
+    return num_new;
+}
+
+
+std::vector<std::uint32_t>
+ColESmry::read_column(std::ifstream& fileH, const Chunk& chunk, int column) const
+{
+    std::uint64_t begin = 0;
+    std::uint64_t end = 0;
+
+    const auto numColumns = m_keyword.size() + 1;
+
+    if (column > 0) {
+        std::uint64_t range[2];
+        if (!readAt(fileH, chunk.columnTable + (column - 1)*sizeof(std::uint64_t), range, 2))
+            OPM_THROW(std::runtime_error, "when reading CSMRY file " + m_inputFileName.string());
+
+        begin = range[0];
+        end = range[1];
+    } else if (!readAt(fileH, chunk.columnTable, &end)) {
+        OPM_THROW(std::runtime_error, "when reading CSMRY file " + m_inputFileName.string());
+    }
+
+    if (end < begin)
+        OPM_THROW(std::runtime_error, "invalid column table in CSMRY file " + m_inputFileName.string());
+
+    std::vector<char> buffer(end - begin);
+    const auto data = chunk.columnTable + numColumns*sizeof(std::uint64_t) + begin;
+
+    if (!readAt(fileH, data, buffer.data(), buffer.size()))
+        OPM_THROW(std::runtime_error, "when reading CSMRY file " + m_inputFileName.string());
+
+    std::vector<std::uint32_t> words(chunk.numSteps);
+    ColSmry::decodeColumn(buffer.data(), buffer.size(), words.data(), words.size());
+
+    return words;
+}
+
+
+void ColESmry::loadData(const std::vector<std::string>& stringVect)
+{
+    auto start = std::chrono::system_clock::now();
+
+    std::vector<int> keyIndexVect;
+    keyIndexVect.reserve(stringVect.size());
+
+    for (const auto& key : stringVect) {
+        const auto it = m_keyword_index.find(key);
+        if (it == m_keyword_index.end())
+            throw std::invalid_argument("summary key '" + key + "' not found");
+
+        if (!m_vectorLoaded[it->second] &&
+            (std::find(keyIndexVect.begin(), keyIndexVect.end(), it->second) == keyIndexVect.end()))
+        {
+            keyIndexVect.push_back(it->second);
+        }
+    }
+
+    if (keyIndexVect.empty())
+        return;
+
+    std::ifstream fileH(m_inputFileName, std::ios::in | std::ios::binary);
+
+    if (!fileH)
+        OPM_THROW(std::runtime_error, "when loading data from CSMRY file " + m_inputFileName.string());
+
+    // visit the columns of a chunk in file order
+    std::vector<int> sorted = keyIndexVect;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (const auto kind : sorted)
+        m_vectorData[kind].resize(m_nTstep);
+
+    for (const auto& chunk : m_chunks) {
+        for (const auto kind : sorted) {
+            const auto words = read_column(fileH, chunk, kind + 1);
+            std::memcpy(m_vectorData[kind].data() + chunk.firstStep, words.data(),
+                        words.size() * sizeof(float));
+        }
+    }
+
+    for (const auto kind : keyIndexVect)
+        m_vectorLoaded[kind] = true;
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+}
+
+
+void ColESmry::loadData()
+{
+    this->loadData(m_keyword);
+}
+
+
+const std::vector<float>& ColESmry::get(const std::string& name)
+{
+    const auto it = m_keyword_index.find(name);
+    if (it == m_keyword_index.end())
+        throw std::invalid_argument("summary key '" + name + "' not found");
+
+    if (!m_vectorLoaded[it->second])
+        loadData({name});
+
+    return m_vectorData[it->second];
+}
+
+
+std::vector<float> ColESmry::get_at_rstep(const std::string& name)
+{
+    const auto& full_vect = this->get(name);
+
+    std::vector<float> rs_vect;
+    rs_vect.reserve(m_seqIndex.size());
+
+    std::transform(m_seqIndex.begin(), m_seqIndex.end(),
+                   std::back_inserter(rs_vect),
+                   [&full_vect](const auto& r)
+                   {
+                       return full_vect[r];
+                   });
+
+    return rs_vect;
+}
+
+
+const std::string& ColESmry::get_unit(const std::string& name) const
+{
+    const auto it = kwunits.find(name);
+    if (it == kwunits.end())
+        throw std::invalid_argument("summary key '" + name + "' not found");
+
+    return it->second;
+}
+
+
+std::vector<Opm::time_point> ColESmry::dates()
+{
+    double time_unit = 24 * 3600;
+    std::vector<Opm::time_point> d;
+
+    const auto& time = this->get("TIME");
+    std::transform(time.begin(), time.end(), std::back_inserter(d),
+                  [this, time_unit](const auto& t)
+                  {
+                      using Seconds = std::chrono::duration<double, std::chrono::seconds::period>;
+                      return this->m_startdat + std::chrono::duration_cast<time_point::duration>(Seconds{t * time_unit});
+                  });
+
+    return d;
+}
+
+
+std::vector<std::string> ColESmry::keywordList(const std::string& pattern) const
+{
+    std::vector<std::string> list;
+    std::copy_if(m_keyword.begin(), m_keyword.end(), std::back_inserter(list),
+                 [&pattern](const auto& key)
+                 {
+                     return shmatch(pattern, key);
+                 });
+
+    return list;
+}
+
+
+bool ColESmry::hasKey(const std::string& key) const
+{
+    return m_keyword_index.find(key) != m_keyword_index.end();
+}
+
+
+std::tuple<double, double> ColESmry::get_io_elapsed() const
+{
+    return std::make_tuple(m_io_opening, m_io_loading);
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,122 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_COLESMRY_HPP
+#define OPM_IO_COLESMRY_HPP
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Reader of columnar summary files (.CSMRY) written by ColSmryOutput.
+///
+/// Opening the file reads the directory and the chunk headers, plus the
+/// report step column.  Loading a vector reads only that vector's column
+/// from each chunk, i.e., the amount of data read is proportional to the
+/// number of time steps and independent of the number of vectors in the
+/// file.  Chunks which are still being written when the file is opened are
+/// ignored, and picked up by a later call to refresh().
+class ColESmry
+{
+public:
+    explicit ColESmry(const std::string& filename);
+
+    const std::vector<float>& get(const std::string& name);
+    std::vector<float> get_at_rstep(const std::string& name);
+    const std::string& get_unit(const std::string& name) const;
+
+    void loadData();
+    void loadData(const std::vector<std::string>& stringVect);
+
+    time_point startdate() const { return m_startdat; }
+    const std::vector<int>& start_v() const { return m_start_vect; }
+
+    bool hasKey(const std::string& key) const;
+
+    std::size_t numberOfTimeSteps() const { return m_nTstep; }
+    std::size_t numberOfVectors() const { return m_keyword.size(); }
+
+    const std::vector<std::string>& keywordList() const { return m_keyword; }
+    std::vector<std::string> keywordList(const std::string& pattern) const;
+
+    std::vector<time_point> dates();
+
+    // Pick up chunks appended to the CSMRY file of an active run since
+    // construction or the previous call to refresh().  Only the new chunks
+    // of each loaded vector are read.  Returns the number of new time
+    // steps.
+    std::size_t refresh();
+
+    /// Restart source, i.e., root name and report step, of the run.  Root
+    /// name is empty if the run is not a restarted run.
+    std::tuple<std::string, int> restart_info() const { return m_restart; }
+
+    std::string rootname() const { return m_inputFileName.stem().generic_string(); }
+    std::tuple<double, double> get_io_elapsed() const;
+
+private:
+    struct Chunk
+    {
+        std::uint64_t columnTable;   // file offset of columnEnd table
+        std::uint64_t firstStep;
+        std::uint32_t numSteps;
+    };
+
+    std::filesystem::path m_inputFileName;
+
+    std::vector<std::string> m_keyword;
+    std::map<std::string, int> m_keyword_index;
+    std::unordered_map<std::string, std::string> kwunits;
+
+    std::vector<Chunk> m_chunks;
+    std::size_t m_nTstep{0};
+
+    std::vector<int> m_rstep;
+    std::vector<int> m_seqIndex;
+
+    std::vector<std::vector<float>> m_vectorData;
+    std::vector<bool> m_vectorLoaded;
+
+    time_point m_startdat;
+    std::vector<int> m_start_vect;
+    std::tuple<std::string, int> m_restart;
+
+    // file offset just past the last complete record read so far
+    std::uint64_t m_scanPos{0};
+    bool m_haveDirectory{false};
+
+    double m_io_opening{0.0};
+    double m_io_loading{0.0};
+
+    bool open_csmry();
+    bool read_records(std::size_t& num_new);
+    std::vector<std::uint32_t> read_column(std::ifstream& fileH, const Chunk& chunk, int column) const;
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_COLESMRY_HPP
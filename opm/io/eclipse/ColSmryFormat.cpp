@@ -0,0 +1,280 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ColSmryFormat.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+    void corrupt(const std::string& what)
+    {
+        OPM_THROW(std::runtime_error, "Corrupt columnar summary file, " + what);
+    }
+
+    template <typename T>
+    void put(std::vector<char>& buffer, const T& value)
+    {
+        const auto pos = buffer.size();
+        buffer.resize(pos + sizeof(T));
+        std::memcpy(buffer.data() + pos, &value, sizeof(T));
+    }
+
+    void putString(std::vector<char>& buffer, const std::string& str)
+    {
+        put(buffer, static_cast<std::uint32_t>(str.size()));
+        buffer.insert(buffer.end(), str.begin(), str.end());
+    }
+
+    class Unpacker
+    {
+    public:
+        Unpacker(const char* data, std::size_t length)
+            : data_(data), length_(length)
+        {}
+
+        template <typename T>
+        T get()
+        {
+            this->require(sizeof(T));
+
+            T value;
+            std::memcpy(&value, this->data_ + this->pos_, sizeof(T));
+            this->pos_ += sizeof(T);
+
+            return value;
+        }
+
+        std::string getString()
+        {
+            const auto n = this->get<std::uint32_t>();
+            this->require(n);
+
+            std::string str(this->data_ + this->pos_, n);
+            this->pos_ += n;
+
+            return str;
+        }
+
+    private:
+        const char* data_;
+        std::size_t length_;
+        std::size_t pos_{0};
+
+        void require(std::size_t n) const
+        {
+            if (this->pos_ + n > this->length_)
+                corrupt("directory record truncated");
+        }
+    };
+
+    // Byte value 0..127: literal run of value+1 bytes follows.
+    // Byte value 128..255: run of value-127 zero bytes.
+    constexpr std::size_t maxRun = 128;
+
+    void encodeRle(const std::vector<unsigned char>& src, std::vector<char>& dst)
+    {
+        std::size_t i = 0;
+        const auto n = src.size();
+
+        while (i < n) {
+            std::size_t zeros = 0;
+            while ((i + zeros < n) && (src[i + zeros] == 0) && (zeros < maxRun))
+                ++zeros;
+
+            if (zeros >= 2) {
+                dst.push_back(static_cast<char>(127 + zeros));
+                i += zeros;
+                continue;
+            }
+
+            // literal run up to the next pair of zero bytes
+            std::size_t len = 0;
+            while ((i + len < n) && (len < maxRun)) {
+                if ((src[i + len] == 0) && (i + len + 1 < n) && (src[i + len + 1] == 0))
+                    break;
+
+                ++len;
+            }
+
+            dst.push_back(static_cast<char>(len - 1));
+            dst.insert(dst.end(), src.begin() + i, src.begin() + i + len);
+            i += len;
+        }
+    }
+
+    void decodeRle(const char* src, std::size_t length, std::vector<unsigned char>& dst)
+    {
+        std::size_t i = 0;
+        std::size_t pos = 0;
+
+        while (i < length) {
+            const auto control = static_cast<unsigned char>(src[i++]);
+
+            if (control >= 128) {
+                const std::size_t zeros = control - 127;
+                if (pos + zeros > dst.size())
+                    corrupt("column overflow");
+
+                std::fill_n(dst.begin() + pos, zeros, 0);
+                pos += zeros;
+            } else {
+                const std::size_t len = control + 1;
+                if ((pos + len > dst.size()) || (i + len > length))
+                    corrupt("column overflow");
+
+                std::copy_n(src + i, len, dst.begin() + pos);
+                pos += len;
+                i += len;
+            }
+        }
+
+        if (pos != dst.size())
+            corrupt("column too short");
+    }
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO { namespace ColSmry {
+
+std::vector<char> packDirectory(const Directory& dir)
+{
+    if (dir.keys.size() != dir.units.size())
+        OPM_THROW(std::invalid_argument, "Number of summary keys and units differ");
+
+    std::vector<char> buffer;
+
+    put(buffer, static_cast<std::uint32_t>(dir.start.size()));
+    for (const auto& v : dir.start)
+        put(buffer, static_cast<std::int32_t>(v));
+
+    putString(buffer, dir.restartRoot);
+    put(buffer, static_cast<std::int32_t>(dir.restartStep));
+
+    put(buffer, static_cast<std::uint64_t>(dir.keys.size()));
+    for (std::size_t n = 0; n < dir.keys.size(); ++n) {
+        putString(buffer, dir.keys[n]);
+        putString(buffer, dir.units[n]);
+    }
+
+    return buffer;
+}
+
+
+Directory unpackDirectory(const char* data, std::size_t length)
+{
+    Unpacker unpack(data, length);
+    Directory dir;
+
+    dir.start.resize(unpack.get<std::uint32_t>());
+    for (auto& v : dir.start)
+        v = unpack.get<std::int32_t>();
+
+    dir.restartRoot = unpack.getString();
+    dir.restartStep = unpack.get<std::int32_t>();
+
+    const auto nVect = unpack.get<std::uint64_t>();
+    if (nVect > length)
+        corrupt("invalid number of vectors");
+
+    dir.keys.reserve(nVect);
+    dir.units.reserve(nVect);
+
+    for (std::uint64_t n = 0; n < nVect; ++n) {
+        dir.keys.push_back(unpack.getString());
+        dir.units.push_back(unpack.getString());
+    }
+
+    return dir;
+}
+
+
+std::vector<char> encodeColumn(const std::uint32_t* words, std::size_t n, bool compress)
+{
+    std::vector<char> column;
+
+    if (compress && (n > 0)) {
+        // Summary vectors change slowly or not at all between time steps.
+        // XOR with the previous value leaves mostly zero bits, and storing
+        // each byte position as a separate plane collects those zeros into
+        // long runs.
+        std::vector<unsigned char> planes(4*n);
+        std::uint32_t prev = 0;
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto x = words[i] ^ prev;
+            prev = words[i];
+
+            for (std::size_t b = 0; b < 4; ++b)
+                planes[b*n + i] = static_cast<unsigned char>(x >> (8*b));
+        }
+
+        column.push_back(static_cast<char>(Codec::XorRle));
+        encodeRle(planes, column);
+
+        if (column.size() < 1 + 4*n)
+            return column;
+
+        column.clear();
+    }
+
+    column.push_back(static_cast<char>(Codec::Raw));
+    column.resize(1 + 4*n);
+    std::memcpy(column.data() + 1, words, 4*n);
+
+    return column;
+}
+
+
+void decodeColumn(const char* data, std::size_t length, std::uint32_t* words, std::size_t n)
+{
+    if (length < 1)
+        corrupt("empty column");
+
+    const auto codec = static_cast<Codec>(data[0]);
+
+    if (codec == Codec::Raw) {
+        if (length != 1 + 4*n)
+            corrupt("unexpected column size");
+
+        std::memcpy(words, data + 1, 4*n);
+    }
+    else if (codec == Codec::XorRle) {
+        std::vector<unsigned char> planes(4*n);
+        decodeRle(data + 1, length - 1, planes);
+
+        std::uint32_t prev = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::uint32_t x = 0;
+            for (std::size_t b = 0; b < 4; ++b)
+                x |= static_cast<std::uint32_t>(planes[b*n + i]) << (8*b);
+
+            prev ^= x;
+            words[i] = prev;
+        }
+    }
+    else {
+        corrupt("unknown column codec");
+    }
+}
+
+}}} // namespace Opm::EclIO::ColSmry
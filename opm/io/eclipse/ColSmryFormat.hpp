@@ -0,0 +1,107 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_COLSMRYFORMAT_HPP
+#define OPM_IO_COLSMRYFORMAT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO { namespace ColSmry {
+
+// Columnar summary file (.CSMRY), native byte order.
+//
+//   file:    magic[8] | record*
+//   record:  kind u32 | reserved u32 | length u64 | payload[length] | length u64
+//
+// The first record is the directory, holding start date, restart source
+// and the summary keys and units.  It is followed by any number of chunk
+// records, each holding a contiguous range of time steps stored column by
+// column:
+//
+//   chunk:   firstStep u64 | numSteps u32 | numColumns u32
+//            | columnEnd u64[numColumns] | column*
+//   column:  codec u8 | data
+//
+// Column zero holds the report step flags, column n+1 the n-th summary
+// vector.  columnEnd[c] is the end of column c relative to the start of
+// the first column, so a single column is located without reading the
+// others.  Records are only ever appended and are written in one piece.
+// A reader accepts a record once its trailing length is present and
+// matches the leading one, which makes the file safe to read while the
+// simulator is still appending to it.
+
+constexpr std::array<char, 8> magic { 'O', 'P', 'M', 'C', 'S', 'M', 'R', '1' };
+
+enum class RecordKind : std::uint32_t {
+    Directory = 1,
+    Chunk = 2,
+};
+
+enum class Codec : std::uint8_t {
+    Raw = 0,       // 32-bit words as is
+    XorRle = 1,    // xor with previous word, byte planes, zero run-length
+};
+
+struct RecordHeader
+{
+    std::uint32_t kind;
+    std::uint32_t reserved;
+    std::uint64_t length;
+};
+
+static_assert(sizeof(RecordHeader) == 16, "Unexpected padding in record header");
+
+struct ChunkHeader
+{
+    std::uint64_t firstStep;
+    std::uint32_t numSteps;
+    std::uint32_t numColumns;
+};
+
+static_assert(sizeof(ChunkHeader) == 16, "Unexpected padding in chunk header");
+
+constexpr std::uint64_t recordOverhead = sizeof(RecordHeader) + sizeof(std::uint64_t);
+
+struct Directory
+{
+    std::vector<int> start;
+    std::string restartRoot;
+    int restartStep = 0;
+    std::vector<std::string> keys;
+    std::vector<std::string> units;
+};
+
+std::vector<char> packDirectory(const Directory& dir);
+Directory unpackDirectory(const char* data, std::size_t length);
+
+/// Encode \p n 32-bit words, e.g., float bit patterns, as one column.  The
+/// XorRle codec is only used if \p compress is set and it actually reduces
+/// the size.
+std::vector<char> encodeColumn(const std::uint32_t* words, std::size_t n, bool compress);
+
+/// Decode a column of \p length bytes into exactly \p n words.  Throws
+/// std::runtime_error if the column is corrupt.
+void decodeColumn(const char* data, std::size_t length, std::uint32_t* words, std::size_t n);
+
+}}} // namespace Opm::EclIO::ColSmry
+
+#endif // OPM_IO_COLSMRYFORMAT_HPP
@@ -0,0 +1,171 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ColSmryOutput.hpp>
+#include <opm/io/eclipse/ColSmryFormat.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+namespace Opm { namespace EclIO {
+
+ColSmryOutput::ColSmryOutput(const std::string& filename,
+                             const std::vector<std::string>& keys,
+                             const std::vector<std::string>& units,
+                             const std::vector<int>& start_date,
+                             const std::string& restart_root,
+                             int restart_step,
+                             const Options& options)
+    : m_outputFileName(filename)
+    , m_options(options)
+    , m_nVect(keys.size())
+    , m_nTimeSteps(0)
+    , m_firstBuffered(0)
+    , m_last_flush(std::chrono::steady_clock::now())
+    , m_columns(keys.size())
+{
+    if (m_options.chunkSize < 1)
+        throw std::invalid_argument("chunk size of columnar summary file must be positive");
+
+    m_ofileH.open(m_outputFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!m_ofileH)
+        OPM_THROW(std::runtime_error, "Could not open file: '" + m_outputFileName + "'");
+
+    ColSmry::Directory dir;
+    dir.start = start_date;
+    dir.restartRoot = restart_root;
+    dir.restartStep = restart_step;
+    dir.keys = keys;
+    dir.units = units;
+
+    m_ofileH.write(ColSmry::magic.data(), ColSmry::magic.size());
+    this->writeRecord(static_cast<std::uint32_t>(ColSmry::RecordKind::Directory),
+                      ColSmry::packDirectory(dir));
+
+    for (auto& column : m_columns)
+        column.reserve(m_options.chunkSize);
+}
+
+
+ColSmryOutput::~ColSmryOutput()
+{
+    try {
+        this->flush();
+    }
+    catch (const std::exception& e) {
+        OpmLog::warning("Failed to write columnar summary file " + m_outputFileName + ": " + e.what());
+    }
+}
+
+
+void ColSmryOutput::write(const std::vector<float>& ts_data, int report_step, bool is_final_summary)
+{
+    if (ts_data.size() != m_nVect)
+        throw std::invalid_argument("size of ts_data vector not same as number of smry vectors");
+
+    m_rstep.push_back(static_cast<std::uint32_t>(report_step));
+
+    for (std::size_t n = 0; n < m_nVect; n++) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &ts_data[n], sizeof(bits));
+        m_columns[n].push_back(bits);
+    }
+
+    m_nTimeSteps++;
+
+    const auto timed_flush = (m_options.flushInterval > std::chrono::seconds::zero()) &&
+        (std::chrono::steady_clock::now() - m_last_flush >= m_options.flushInterval);
+
+    if (is_final_summary ||
+        (m_rstep.size() >= static_cast<std::size_t>(m_options.chunkSize)) ||
+        timed_flush)
+    {
+        this->flush();
+    }
+}
+
+
+void ColSmryOutput::flush()
+{
+    m_last_flush = std::chrono::steady_clock::now();
+
+    if (m_rstep.empty())
+        return;
+
+    const auto numSteps = m_rstep.size();
+    const auto numColumns = m_nVect + 1;
+
+    std::vector<std::vector<char>> encoded;
+    encoded.reserve(numColumns);
+
+    encoded.push_back(ColSmry::encodeColumn(m_rstep.data(), numSteps, m_options.compress));
+    for (const auto& column : m_columns)
+        encoded.push_back(ColSmry::encodeColumn(column.data(), numSteps, m_options.compress));
+
+    const ColSmry::ChunkHeader header {
+        m_firstBuffered,
+        static_cast<std::uint32_t>(numSteps),
+        static_cast<std::uint32_t>(numColumns)
+    };
+
+    std::vector<std::uint64_t> columnEnd(numColumns);
+    std::uint64_t end = 0;
+
+    for (std::size_t c = 0; c < numColumns; ++c) {
+        end += encoded[c].size();
+        columnEnd[c] = end;
+    }
+
+    std::vector<char> payload(sizeof(header) + numColumns*sizeof(std::uint64_t));
+    std::memcpy(payload.data(), &header, sizeof(header));
+    std::memcpy(payload.data() + sizeof(header), columnEnd.data(), numColumns*sizeof(std::uint64_t));
+
+    payload.reserve(payload.size() + end);
+    for (const auto& column : encoded)
+        payload.insert(payload.end(), column.begin(), column.end());
+
+    this->writeRecord(static_cast<std::uint32_t>(ColSmry::RecordKind::Chunk), payload);
+
+    m_firstBuffered += numSteps;
+    m_rstep.clear();
+    for (auto& column : m_columns)
+        column.clear();
+}
+
+
+void ColSmryOutput::writeRecord(std::uint32_t kind, const std::vector<char>& payload)
+{
+    const ColSmry::RecordHeader header { kind, 0, payload.size() };
+    const std::uint64_t trailer = payload.size();
+
+    // the trailing length is written last and marks the record complete
+    m_ofileH.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_ofileH.write(payload.data(), payload.size());
+    m_ofileH.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+    m_ofileH.flush();
+
+    if (!m_ofileH)
+        OPM_THROW(std::runtime_error, "Failed writing to columnar summary file " + m_outputFileName);
+}
+
+}} // namespace Opm::EclIO
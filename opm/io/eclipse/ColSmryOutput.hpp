@@ -0,0 +1,93 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_COLSMRYOUTPUT_HPP
+#define OPM_IO_COLSMRYOUTPUT_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Writer of columnar summary files (.CSMRY).
+///
+/// Time steps are buffered and appended to the file as chunks of columns,
+/// see ColSmryFormat.hpp.  A chunk is written once it holds chunkSize time
+/// steps, when a non-zero flushInterval has passed since the previous
+/// chunk, or on flush().  Each chunk carries a table of column offsets, so
+/// the default is to write full chunks only.  Previously written data is never rewritten, so the cost of
+/// each chunk is independent of the length of the run, and ColESmry can
+/// read the file while it is being written.
+class ColSmryOutput
+{
+public:
+    struct Options
+    {
+        int chunkSize;
+        bool compress;
+        std::chrono::seconds flushInterval;
+    };
+
+    static Options defaultOptions() { return { 1024, true, std::chrono::seconds::zero() }; }
+
+    ColSmryOutput(const std::string& filename,
+                  const std::vector<std::string>& keys,
+                  const std::vector<std::string>& units,
+                  const std::vector<int>& start_date,
+                  const std::string& restart_root = "",
+                  int restart_step = 0,
+                  const Options& options = defaultOptions());
+
+    ~ColSmryOutput();
+
+    ColSmryOutput(const ColSmryOutput&) = delete;
+    ColSmryOutput& operator=(const ColSmryOutput&) = delete;
+
+    void write(const std::vector<float>& ts_data,
+               int report_step,
+               bool is_final_summary);
+
+    /// Append all buffered time steps to the file.
+    void flush();
+
+    std::size_t numberOfTimeSteps() const { return m_nTimeSteps; }
+
+private:
+    std::string m_outputFileName;
+    std::ofstream m_ofileH;
+    Options m_options;
+
+    std::size_t m_nVect;
+    std::size_t m_nTimeSteps;
+    std::uint64_t m_firstBuffered;
+
+    std::chrono::time_point<std::chrono::steady_clock> m_last_flush;
+
+    // buffered time steps, one column per vector plus report step flags
+    std::vector<std::uint32_t> m_rstep;
+    std::vector<std::vector<std::uint32_t>> m_columns;
+
+    void writeRecord(std::uint32_t kind, const std::vector<char>& payload);
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_COLSMRYOUTPUT_HPP
@@ -24,7 +24,7 @@
 namespace Opm { namespace EclIO {
 
 
-EInit::EInit(const std::string &filename) : EclFile(filename)
+EInit::EInit(const std::string &filename, EclFile::MemoryMapped mmap) : EclFile(filename, mmap)
 {
     std::string lgrname;
 
@@ -51,8 +51,8 @@ namespace {
 
 namespace Opm { namespace EclIO {
 
-ERst::ERst(const std::string& filename)
-    : EclFile(filename)
+ERst::ERst(const std::string& filename, EclFile::MemoryMapped mmap)
+    : EclFile(filename, mmap)
 {
     if (this->hasKey("SEQNUM")) {
         this->initUnified();
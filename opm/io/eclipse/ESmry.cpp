@@ -43,6 +43,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -113,6 +114,13 @@ bool is_well_completion(const std::string& keyword)
     return std::regex_match(keyword, well_compl_kw);
 }
 
+// Size of array header, including record markers for binary files, of
+// MINISTEP, PARAMS and SEQHDR arrays in summary data files.
+std::uint64_t summaryHeaderSize(const bool formatted)
+{
+    return formatted ? 31 : 24;
+}
+
 }
 
 
@@ -125,6 +133,9 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
     m_io_opening = 0.0;
     m_io_loading = 0.0;
 
+    liveFilePos = 0;
+    liveProvisionalRstep = false;
+
     auto start = std::chrono::system_clock::now();
 
     fromSingleRun = !loadBaseRunData;
@@ -439,10 +450,10 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
         const std::vector<std::string> keywords = smspecList[specInd].get<std::string>("KEYWORDS");
         std::vector<std::string> wgnames;
 
-        if (smspecList.back().hasKey("WGNAMES"))
-            wgnames = smspecList.back().get<std::string>("WGNAMES");
+        if (smspecList[specInd].hasKey("WGNAMES"))
+            wgnames = smspecList[specInd].get<std::string>("WGNAMES");
         else
-            wgnames = smspecList.back().get<std::string>("NAMES");
+            wgnames = smspecList[specInd].get<std::string>("NAMES");
 
         const std::vector<int> nums = smspecList[specInd].get<int>("NUMS");
 
@@ -554,11 +565,12 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
         }
 
         std::vector<ArrSourceEntry> arraySourceList;
+        std::uint64_t endPos = 0;
 
         for (std::string fileName : resultsFileList)
         {
             std::vector<std::tuple <std::string, std::uint64_t>> arrayList;
-            arrayList = this->getListOfArrays(fileName, formattedFiles[specInd]);
+            arrayList = this->getListOfArrays(fileName, formattedFiles[specInd], 0, endPos);
 
             for (size_t n = 0; n < arrayList.size(); n++) {
                 ArrSourceEntry  t1 = std::make_tuple(std::get<0>(arrayList[n]), fileName, n, std::get<1>(arrayList[n]));
@@ -573,7 +585,7 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
         //       else : MINISTEP and PARAMS
 
 
-        size_t i = std::get<0>(arraySourceList[0]) == "SEQHDR" ? 1 : 0 ;
+        size_t i = (!arraySourceList.empty() && (std::get<0>(arraySourceList[0]) == "SEQHDR")) ? 1 : 0 ;
 
         while  (i < arraySourceList.size()) {
 
@@ -582,6 +594,10 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
                 throw std::invalid_argument(message);
             }
 
+            // PARAMS of last time step not yet written by an active run
+            if (i + 1 == arraySourceList.size())
+                break;
+
             if (std::get<0>(arraySourceList[i+1]) != "PARAMS") {
                 std::string message="Reading summary file, expecting keyword PARAMS, found '" + std::get<0>(arraySourceList[i]) + "'";
                 throw std::invalid_argument(message);
@@ -621,6 +637,19 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
             step++;
         }
 
+        if (specInd == 0) {
+            // Remember where the data of the active run ends, see refresh()
+            if (i < arraySourceList.size()) {
+                liveDataFile = std::get<1>(arraySourceList[i]);
+                liveFilePos = std::get<3>(arraySourceList[i]) - summaryHeaderSize(formattedFiles[specInd]);
+            } else {
+                liveDataFile = resultsFileList.back();
+                liveFilePos = endPos;
+                liveProvisionalRstep = !arraySourceList.empty()
+                    && (std::get<0>(arraySourceList.back()) == "PARAMS");
+            }
+        }
+
         fromReportStepNumber = toReportStepNumber;
 
         specInd--;
@@ -634,11 +663,11 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
 
 void ESmry::read_ministeps_from_disk()
 {
-    if (miniStepList.empty())
+    if (mini_steps.size() >= miniStepList.size())
         return;
 
-    auto specInd = std::get<0>(miniStepList[0]);
-    auto dataFileIndex = std::get<1>(miniStepList[0]);
+    auto specInd = std::get<0>(miniStepList[mini_steps.size()]);
+    auto dataFileIndex = std::get<1>(miniStepList[mini_steps.size()]);
 
     std::fstream fileH;
 
@@ -649,7 +678,8 @@ void ESmry::read_ministeps_from_disk()
 
     int ministep_value;
 
-    for (size_t n = 0; n < miniStepList.size(); n++) {
+    // Ministeps read previously are kept, see refresh()
+    for (size_t n = mini_steps.size(); n < miniStepList.size(); n++) {
 
         if (dataFileIndex != std::get<1>(miniStepList[n])) {
             fileH.close();
@@ -718,100 +748,24 @@ std::string ESmry::read_string_from_disk(std::fstream& fileH, uint64_t size) con
 void ESmry::loadData(const std::vector<std::string>& vectList) const
 {
     auto start = std::chrono::system_clock::now();
-    size_t nvect = vectList.size();
 
     std::vector<int> keywIndVect;
-    keywIndVect.reserve(nvect);
+    keywIndVect.reserve(vectList.size());
 
-    for (auto key : vectList) {
+    for (const auto& key : vectList) {
         if (!hasKey(key))
             OPM_THROW(std::invalid_argument, "error loading key " + key );
 
         auto it = keyword_index.find(key);
 
-        if (!vectorLoaded[it->second])
+        if (!vectorLoaded[it->second] &&
+            (std::find(keywIndVect.begin(), keywIndVect.end(), it->second) == keywIndVect.end()))
+        {
             keywIndVect.push_back(it->second);
-    }
-
-    for (auto ind : keywIndVect)
-        vectorData[ind].reserve(nTstep);
-
-    std::fstream fileH;
-
-    auto specInd = std::get<0>(timeStepList[0]);
-    auto dataFileIndex = std::get<1>(timeStepList[0]);
-    std::uint64_t blockSize_f;
-
-    {
-        const int nLinesBlock = MaxBlockSizeReal / numColumnsReal;
-
-        blockSize_f= static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
-    }
-
-    if (formattedFiles[specInd])
-        fileH.open(dataFileList[dataFileIndex], std::ios::in);
-    else
-        fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
-
-    for (const auto& ministep : timeStepList) {
-        if (dataFileIndex != std::get<1>(ministep)) {
-            fileH.close();
-            specInd = std::get<0>(ministep);
-            dataFileIndex = std::get<1>(ministep);
-
-            if (formattedFiles[specInd])
-                fileH.open(dataFileList[dataFileIndex], std::ios::in );
-            else
-                fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
-        }
-
-        const auto stepFilePos = std::get<2>(ministep);;
-
-        for (auto ind : keywIndVect) {
-            auto it = arrayPos[specInd].find(ind);
-            if (it == arrayPos[specInd].end()) {
-                // undefined vector in current summary file. Typically when loading
-                // base restart run and including base run data. Vectors can be added to restart runs
-                vectorData[ind].push_back(std::nanf(""));
-            }
-            else {
-                int paramPos = it->second;
-
-                if (formattedFiles[specInd]) {
-                    std::uint64_t elementPos = 0;
-                    int nBlocks = paramPos / MaxBlockSizeReal;
-                    int sizeOfLastBlock = paramPos %  MaxBlockSizeReal;
-
-                    if (nBlocks > 0)
-                        elementPos = static_cast<uint64_t>(nBlocks * blockSize_f);
-
-                    int nLines = sizeOfLastBlock / numColumnsReal;
-                    elementPos = stepFilePos + elementPos + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines);
-
-                    fileH.seekg (elementPos, fileH.beg);
-
-                    const std::size_t size = columnWidthReal;
-                    std::vector<char> buffer(size);
-                    fileH.read (buffer.data(), size);
-                    vectorData[ind].push_back(std::strtof(buffer.data(), nullptr));
-                }
-                else {
-                    const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
-                    std::uint64_t elementPos = ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte);
-                    elementPos += static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal) + stepFilePos;
-
-                    fileH.seekg (elementPos, fileH.beg);
-
-                    float value;
-                    fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
-
-                    vectorData[ind].push_back(Opm::EclIO::flipEndianFloat(value));
-                }
-            }
         }
     }
 
-    fileH.close();
+    this->readTimeSteps(0, keywIndVect);
 
     for (const auto& ind : keywIndVect)
         vectorLoaded[ind] = true;
@@ -956,7 +910,7 @@ void ESmry::loadData() const
 
 
 std::vector<std::tuple <std::string, uint64_t>>
-ESmry::getListOfArrays(const std::string& filename, bool formatted)
+ESmry::getListOfArrays(const std::string& filename, bool formatted, uint64_t fromPos, uint64_t& endPos)
 {
     std::vector<std::tuple <std::string, uint64_t>> resultVect;
 
@@ -966,17 +920,26 @@ ESmry::getListOfArrays(const std::string& filename, bool formatted)
 
     int64_t num;
 
+    // Arrays extending beyond the current end of file are being written
+    // by an active run.  Stop at the first such array and report the
+    // position of its header through endPos.
+
+    const uint64_t fileSize = std::filesystem::file_size(filename);
+    const uint64_t headerSize = summaryHeaderSize(formatted);
+
     if (formatted)
         ptr = fopen(filename.c_str(),"r");  // r for read, files opened as text files
     else
         ptr = fopen(filename.c_str(),"rb");  // r for read, b for binary
 
-    bool endOfFile = false;
+    endPos = fromPos;
 
-    while (!endOfFile)
+    while (endPos + headerSize <= fileSize)
     {
         Opm::EclIO::eclArrType arrType;
 
+        fseek(ptr, static_cast<long int>(endPos), SEEK_SET);
+
         if (formatted)
         {
             fseek(ptr, 2, SEEK_CUR);
@@ -1032,26 +995,21 @@ ESmry::getListOfArrays(const std::string& filename, bool formatted)
             }
         }
 
-        uint64_t filePos = static_cast<uint64_t>(ftell(ptr));
-
-        std::tuple <std::string, uint64_t> t1;
-        t1 = std::make_tuple(Opm::EclIO::trimr(arrName), filePos);
-        resultVect.push_back(t1);
+        const uint64_t filePos = endPos + headerSize;
+        uint64_t sizeOfNextArray = 0;
 
         if (num > 0) {
-            if (formatted) {
-                uint64_t sizeOfNextArray = sizeOnDiskFormatted(num, arrType, 4);
-                fseek(ptr, static_cast<long int>(sizeOfNextArray), SEEK_CUR);
-            } else {
-                uint64_t sizeOfNextArray = sizeOnDiskBinary(num, arrType, 4);
-                fseek(ptr, static_cast<long int>(sizeOfNextArray), SEEK_CUR);
-            }
+            sizeOfNextArray = formatted
+                ? sizeOnDiskFormatted(num, arrType, 4)
+                : sizeOnDiskBinary(num, arrType, 4);
         }
 
-        if (fgetc(ptr) == EOF)
-            endOfFile = true;
-        else
-            fseek(ptr, -1, SEEK_CUR);
+        if (filePos + sizeOfNextArray > fileSize)
+            break;
+
+        resultVect.emplace_back(Opm::EclIO::trimr(arrName), filePos);
+
+        endPos = filePos + sizeOfNextArray;
     }
 
     fclose(ptr);
@@ -1059,6 +1017,282 @@ ESmry::getListOfArrays(const std::string& filename, bool formatted)
     return resultVect;
 }
 
+void ESmry::appendTimeSteps(const std::vector<std::tuple <std::string, uint64_t>>& arrayList,
+                            const std::string& fileName, uint64_t endPos)
+{
+    if (arrayList.empty())
+        return;
+
+    // The last time step was taken to be a report step since it ended the
+    // data.  Confirmed by a SEQHDR, otherwise revoked by another MINISTEP.
+
+    size_t i = 0;
+
+    if (std::get<0>(arrayList[i]) == "SEQHDR")
+        i++;
+    else if (liveProvisionalRstep)
+        seqIndex.pop_back();
+
+    liveProvisionalRstep = false;
+
+    while (i < arrayList.size()) {
+
+        if (std::get<0>(arrayList[i]) != "MINISTEP") {
+            std::string message="Reading summary file, expecting keyword MINISTEP, found '" + std::get<0>(arrayList[i]) + "'";
+            throw std::invalid_argument(message);
+        }
+
+        if (i + 1 == arrayList.size())
+            break;
+
+        if (std::get<0>(arrayList[i+1]) != "PARAMS") {
+            std::string message="Reading summary file, expecting keyword PARAMS, found '" + std::get<0>(arrayList[i+1]) + "'";
+            throw std::invalid_argument(message);
+        }
+
+        auto it = std::find(dataFileList.begin(), dataFileList.end(), fileName);
+        if (it == dataFileList.end())
+            it = dataFileList.insert(dataFileList.end(), fileName);
+
+        const int dataFileIndex = static_cast<int>(std::distance(dataFileList.begin(), it));
+
+        miniStepList.emplace_back(0, dataFileIndex, std::get<1>(arrayList[i]));
+        timeStepList.emplace_back(0, dataFileIndex, std::get<1>(arrayList[i+1]));
+
+        i += 2;
+
+        if (i < arrayList.size()) {
+            if (std::get<0>(arrayList[i]) == "SEQHDR") {
+                i++;
+                seqIndex.push_back(timeStepList.size() - 1);
+            }
+        } else {
+            seqIndex.push_back(timeStepList.size() - 1);
+            liveProvisionalRstep = true;
+        }
+    }
+
+    liveDataFile = fileName;
+    liveFilePos = (i < arrayList.size())
+        ? std::get<1>(arrayList[i]) - summaryHeaderSize(formattedFiles[0])
+        : endPos;
+
+    nTstep = timeStepList.size();
+}
+
+size_t ESmry::refresh()
+{
+    if (liveDataFile.empty())
+        return 0;
+
+    auto start = std::chrono::system_clock::now();
+
+    const auto nOldTstep = timeStepList.size();
+
+    auto scanFile = [this](const std::string& fileName, const uint64_t fromPos)
+    {
+        uint64_t endPos = fromPos;
+        const auto arrayList = this->getListOfArrays(fileName, formattedFiles[0], fromPos, endPos);
+        this->appendTimeSteps(arrayList, fileName, endPos);
+    };
+
+    scanFile(liveDataFile, liveFilePos);
+
+    // With separate (non-unified) summary files, each new report step
+    // starts a new file.
+
+    const std::filesystem::path livePath(liveDataFile);
+
+    if ((livePath.extension() != ".UNSMRY") && (livePath.extension() != ".FUNSMRY")) {
+        const auto rootN = livePath.parent_path() / livePath.stem();
+
+        for (const auto& fileName : checkForMultipleResultFiles(rootN, formattedFiles[0]))
+            if (fileName > liveDataFile)
+                scanFile(fileName, 0);
+    }
+
+    const auto nNewTstep = timeStepList.size() - nOldTstep;
+
+    if (nNewTstep > 0) {
+        if (!mini_steps.empty())
+            this->read_ministeps_from_disk();
+
+        std::vector<int> loadedVect;
+
+        for (size_t ind = 0; ind < nVect; ind++)
+            if (vectorLoaded[ind])
+                loadedVect.push_back(static_cast<int>(ind));
+
+        this->readTimeSteps(nOldTstep, loadedVect);
+    }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+
+    return nNewTstep;
+}
+
+void ESmry::readTimeSteps(size_t firstStep, const std::vector<int>& keywIndVect) const
+{
+    // Time steps [firstStep, nTstep) of the requested vectors are read by
+    // concurrent workers, each handling a range of consecutive time steps
+    // from the same data file through its own file stream.  Workers store
+    // values directly at their final position in vectorData.
+
+    const auto numSteps = timeStepList.size();
+    const auto nvect = keywIndVect.size();
+
+    if ((nvect == 0) || (firstStep >= numSteps))
+        return;
+
+    // Position in PARAMS of each requested vector, for each summary file,
+    // -1 if not defined in that file.
+    std::vector<int> paramPos(nSpecFiles * nvect, -1);
+
+    for (int specInd = 0; specInd < nSpecFiles; specInd++) {
+        for (size_t n = 0; n < nvect; n++) {
+            auto it = arrayPos[specInd].find(keywIndVect[n]);
+            if (it != arrayPos[specInd].end())
+                paramPos[specInd * nvect + n] = it->second;
+        }
+    }
+
+    for (const auto& ind : keywIndVect)
+        vectorData[ind].resize(numSteps);
+
+    const size_t maxSegmentSize = 64;
+
+    std::vector<std::pair<size_t, size_t>> segments;
+
+    for (size_t step = firstStep; step < numSteps;) {
+        size_t end = step + 1;
+
+        while ((end < numSteps) && (end - step < maxSegmentSize) &&
+               (std::get<1>(timeStepList[end]) == std::get<1>(timeStepList[step])))
+            ++end;
+
+        segments.emplace_back(step, end);
+        step = end;
+    }
+
+    std::uint64_t blockSize_f;
+
+    {
+        const int nLinesBlock = MaxBlockSizeReal / numColumnsReal;
+
+        blockSize_f= static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
+    }
+
+    auto readSegment = [&](const size_t from, const size_t to)
+    {
+        const auto specInd = std::get<0>(timeStepList[from]);
+        const auto dataFileIndex = std::get<1>(timeStepList[from]);
+
+        const bool formatted = formattedFiles[specInd];
+        const int nParams = nParamsSpecFile[specInd];
+        const int* keywPos = paramPos.data() + specInd * nvect;
+
+        // One sequential read of each PARAMS record is cheaper than seeking
+        // to the requested elements, unless very few are requested.
+        const bool fullRecord = nvect * 1024 >= static_cast<size_t>(nParams);
+
+        std::fstream fileH;
+
+        if (formatted)
+            fileH.open(dataFileList[dataFileIndex], std::ios::in);
+        else
+            fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+
+        if (!fileH)
+            OPM_THROW(std::runtime_error, "Can not open summary data file " + dataFileList[dataFileIndex]);
+
+        std::vector<float> params;
+
+        for (size_t step = from; step < to; step++) {
+            const auto stepFilePos = std::get<2>(timeStepList[step]);
+
+            if (fullRecord) {
+                fileH.seekg (stepFilePos, fileH.beg);
+
+                if (formatted) {
+                    const auto size = sizeOnDiskFormatted(nParams, Opm::EclIO::REAL, sizeOfReal);
+                    params = readFormattedRealArray(read_string_from_disk(fileH, size), nParams, 0);
+                } else {
+                    params = readBinaryRealArray(fileH, nParams);
+                }
+
+                for (size_t n = 0; n < nvect; n++)
+                    vectorData[keywIndVect[n]][step] = (keywPos[n] < 0) ? std::nanf("") : params[keywPos[n]];
+
+                continue;
+            }
+
+            for (size_t n = 0; n < nvect; n++) {
+                const int paramPos_n = keywPos[n];
+                float& value = vectorData[keywIndVect[n]][step];
+
+                if (paramPos_n < 0) {
+                    // undefined vector in current summary file. Typically when loading
+                    // base restart run and including base run data. Vectors can be added to restart runs
+                    value = std::nanf("");
+                }
+                else if (formatted) {
+                    std::uint64_t elementPos = 0;
+                    int nBlocks = paramPos_n / MaxBlockSizeReal;
+                    int sizeOfLastBlock = paramPos_n %  MaxBlockSizeReal;
+
+                    if (nBlocks > 0)
+                        elementPos = static_cast<uint64_t>(nBlocks * blockSize_f);
+
+                    int nLines = sizeOfLastBlock / numColumnsReal;
+                    elementPos = stepFilePos + elementPos + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines);
+
+                    fileH.seekg (elementPos, fileH.beg);
+
+                    const std::size_t size = columnWidthReal;
+                    std::vector<char> buffer(size);
+                    fileH.read (buffer.data(), size);
+                    value = std::strtof(buffer.data(), nullptr);
+                }
+                else {
+                    const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos_n/(MaxBlockSizeReal / sizeOfReal));
+                    std::uint64_t elementPos = ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte);
+                    elementPos += static_cast<std::uint64_t>(paramPos_n) * static_cast<std::uint64_t>(sizeOfReal) + stepFilePos;
+
+                    fileH.seekg (elementPos, fileH.beg);
+
+                    float raw;
+                    fileH.read(reinterpret_cast<char*>(&raw), sizeOfReal);
+
+                    value = Opm::EclIO::flipEndianFloat(raw);
+                }
+            }
+        }
+    };
+
+    std::vector<std::exception_ptr> errors(segments.size());
+    const auto numSegments = static_cast<int>(segments.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for (int seg = 0; seg < numSegments; ++seg) {
+        try {
+            readSegment(segments[seg].first, segments[seg].second);
+        }
+        catch (...) {
+            errors[seg] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            for (const auto& ind : keywIndVect)
+                vectorData[ind].resize(firstStep);
+
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 bool ESmry::make_esmry_file()
 {
     // check that loadBaseRunData is not set, this function only works for single smspec files
@@ -80,6 +80,13 @@ public:
     void write_rsm_file(std::optional<std::filesystem::path> = std::nullopt) const;
 
     bool all_steps_available();
+
+    // Pick up time steps appended to the summary data of an active run
+    // since construction or the previous call to refresh().  Only data
+    // written after the last consumed record is read and already loaded
+    // vectors are extended in place.  Returns the number of new time steps.
+    size_t refresh();
+
     std::string rootname() { return inputFileName.stem().generic_string(); }
     std::tuple<double, double> get_io_elapsed() const;
 
@@ -118,6 +125,12 @@ private:
     mutable double m_io_opening;
     mutable double m_io_loading;
 
+    // Position of first unconsumed record of the active run, and whether
+    // its last time step is a report step only by virtue of ending the file.
+    std::string liveDataFile;
+    uint64_t liveFilePos;
+    bool liveProvisionalRstep;
+
     std::vector<std::string> checkForMultipleResultFiles(const std::filesystem::path& rootN, bool formatted) const;
 
     void getRstString(const std::vector<std::string>& restartArray,
@@ -152,7 +165,12 @@ private:
     }
 
     std::vector<std::tuple <std::string, uint64_t>>
-    getListOfArrays(const std::string& filename, bool formatted);
+    getListOfArrays(const std::string& filename, bool formatted, uint64_t fromPos, uint64_t& endPos);
+
+    void appendTimeSteps(const std::vector<std::tuple <std::string, uint64_t>>& arrayList,
+                         const std::string& fileName, uint64_t endPos);
+
+    void readTimeSteps(size_t firstStep, const std::vector<int>& keywIndVect) const;
 
     std::vector<int> makeKeywPosVector(int speInd) const;
     std::string read_string_from_disk(std::fstream& fileH, uint64_t size) const;
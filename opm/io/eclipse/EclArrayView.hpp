@@ -0,0 +1,271 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLARRAYVIEW_HPP
+#define OPM_IO_ECLARRAYVIEW_HPP
+
+#include <opm/io/eclipse/ByteSwap.hpp>
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+namespace detail {
+
+    template <typename T>
+    struct ViewTraits;
+
+    template <>
+    struct ViewTraits<int> {
+        using Raw = std::uint32_t;
+        static constexpr int maxBlockSize = MaxBlockSizeInte;
+    };
+
+    template <>
+    struct ViewTraits<float> {
+        using Raw = std::uint32_t;
+        static constexpr int maxBlockSize = MaxBlockSizeReal;
+    };
+
+    template <>
+    struct ViewTraits<double> {
+        using Raw = std::uint64_t;
+        static constexpr int maxBlockSize = MaxBlockSizeDoub;
+    };
+
+    template <>
+    struct ViewTraits<bool> {
+        using Raw = std::uint32_t;
+        static constexpr int maxBlockSize = MaxBlockSizeLogi;
+    };
+
+    /// Convert one big-endian element from the file into its native value.
+    template <typename T>
+    T decodeElement(const char* src)
+    {
+        typename ViewTraits<T>::Raw raw;
+        std::memcpy(&raw, src, sizeof(raw));
+
+        if constexpr (std::is_same_v<T, bool>) {
+            // named LOGI constants refer to the unswapped representation
+            return (raw == true_value_ecl) || (raw == true_value_ix);
+        } else {
+            if constexpr (sizeof(raw) == 8) {
+                byteSwap64(&raw, &raw, 1);
+            } else {
+                byteSwap32(&raw, &raw, 1);
+            }
+
+            T value;
+            std::memcpy(&value, &raw, sizeof(value));
+            return value;
+        }
+    }
+
+    /// Decode \p count elements stored in consecutive Fortran records,
+    /// starting at \p begin, i.e., at the leading record marker of a
+    /// block, into \p result starting at element \p first.  Throws if a
+    /// record marker does not match the expected block length.
+    template <typename T>
+    void unpackBlocks(const char* begin, std::size_t count,
+                      std::vector<T>& result, std::size_t first)
+    {
+        using Raw = typename ViewTraits<T>::Raw;
+        constexpr std::size_t elementsPerBlock = ViewTraits<T>::maxBlockSize / sizeof(Raw);
+
+        const char* block = begin;
+        std::size_t pos = 0;
+
+        while (pos < count) {
+            const auto num = std::min(count - pos, elementsPerBlock);
+            const auto nbytes = static_cast<std::uint32_t>(num * sizeof(Raw));
+
+            std::uint32_t head, tail;
+            std::memcpy(&head, block, sizeof(head));
+            std::memcpy(&tail, block + sizeof(head) + nbytes, sizeof(tail));
+
+            std::uint32_t length;
+            byteSwap32(&head, &length, 1);
+            if ((length != nbytes) || (head != tail)) {
+                throw std::runtime_error("Error reading binary data, inconsistent record markers");
+            }
+
+            const char* src = block + sizeof(head);
+            if constexpr (std::is_same_v<T, bool>) {
+                for (std::size_t i = 0; i < num; ++i) {
+                    result[first + pos + i] = decodeElement<T>(src + i*sizeof(Raw));
+                }
+            } else if constexpr (sizeof(Raw) == 8) {
+                byteSwap64(src, result.data() + first + pos, num);
+            } else {
+                byteSwap32(src, result.data() + first + pos, num);
+            }
+
+            pos += num;
+            block += nbytes + 2*sizeof(head);
+        }
+    }
+
+    /// Decode all \p size elements of an array whose first block starts
+    /// at \p begin.
+    template <typename T>
+    std::vector<T> unpackBlocks(const char* begin, std::size_t size)
+    {
+        std::vector<T> result(size);
+        unpackBlocks(begin, size, result, 0);
+        return result;
+    }
+
+} // namespace detail
+
+/// Lightweight, read-only view of a numeric array in a memory mapped
+/// unformatted ECLIPSE file.
+///
+/// The view refers directly to the mapped pages.  Elements are converted
+/// from big-endian storage on access, and the Fortran record markers that
+/// separate the on-disk blocks are skipped by index arithmetic, so no data
+/// is copied before it is actually used.  The view keeps the underlying
+/// mapping alive and may therefore outlive the EclFile it came from.
+template <typename T>
+class EclArrayView
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        const_iterator() = default;
+        const_iterator(const EclArrayView* view, size_type index)
+            : m_view(view), m_index(index)
+        {}
+
+        T operator*() const { return (*m_view)[m_index]; }
+        T operator[](difference_type n) const { return (*m_view)[m_index + n]; }
+
+        const_iterator& operator++() { ++m_index; return *this; }
+        const_iterator operator++(int) { auto tmp = *this; ++m_index; return tmp; }
+        const_iterator& operator--() { --m_index; return *this; }
+        const_iterator operator--(int) { auto tmp = *this; --m_index; return tmp; }
+
+        const_iterator& operator+=(difference_type n) { m_index += n; return *this; }
+        const_iterator& operator-=(difference_type n) { m_index -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return { m_view, m_index + n }; }
+        const_iterator operator-(difference_type n) const { return { m_view, m_index - n }; }
+
+        difference_type operator-(const const_iterator& rhs) const
+        {
+            return static_cast<difference_type>(m_index) - static_cast<difference_type>(rhs.m_index);
+        }
+
+        bool operator==(const const_iterator& rhs) const { return m_index == rhs.m_index; }
+        bool operator!=(const const_iterator& rhs) const { return m_index != rhs.m_index; }
+        bool operator<(const const_iterator& rhs) const { return m_index < rhs.m_index; }
+
+    private:
+        const EclArrayView* m_view = nullptr;
+        size_type m_index = 0;
+    };
+
+    EclArrayView() = default;
+
+    /// \param mapping Mapped file holding the array.
+    /// \param offset Byte offset of the first block's leading record marker.
+    /// \param size Number of elements in the array.
+    EclArrayView(std::shared_ptr<const MappedFile> mapping,
+                 std::uint64_t offset, std::int64_t size)
+        : m_mapping(std::move(mapping))
+        , m_begin(m_mapping->data() + offset)
+        , m_size(static_cast<size_type>(size))
+    {}
+
+    size_type size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    T operator[](size_type i) const
+    {
+        const auto block = i / elementsPerBlock;
+        const auto elem  = i % elementsPerBlock;
+
+        return detail::decodeElement<T>(m_begin + block*blockStride + sizeof(int) + elem*sizeof(Raw));
+    }
+
+    T at(size_type i) const
+    {
+        if (i >= m_size) {
+            throw std::out_of_range("EclArrayView index out of range");
+        }
+
+        return (*this)[i];
+    }
+
+    const_iterator begin() const { return { this, 0 }; }
+    const_iterator end() const { return { this, m_size }; }
+
+    /// Convert the whole array into a std::vector<T>.
+    ///
+    /// Works one on-disk block at a time and verifies the record markers
+    /// of each block.
+    std::vector<T> to_vector() const
+    {
+        if (m_size > 0) {
+            m_mapping->willNeed(m_begin - m_mapping->data(), diskSize());
+        }
+
+        return detail::unpackBlocks<T>(m_begin, m_size);
+    }
+
+private:
+    using Raw = typename detail::ViewTraits<T>::Raw;
+
+    static constexpr size_type elementsPerBlock = detail::ViewTraits<T>::maxBlockSize / sizeof(Raw);
+    static constexpr size_type blockStride = detail::ViewTraits<T>::maxBlockSize + 2*sizeof(int);
+
+    std::shared_ptr<const MappedFile> m_mapping{};
+    const char* m_begin = nullptr;
+    size_type m_size = 0;
+
+    std::uint64_t diskSize() const
+    {
+        const auto nfull = m_size / elementsPerBlock;
+        const auto rest = m_size % elementsPerBlock;
+
+        return nfull*blockStride + (rest > 0 ? rest*sizeof(Raw) + 2*sizeof(int) : 0);
+    }
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLARRAYVIEW_HPP
@@ -21,18 +21,160 @@
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <cerrno>
 #include <cstring>
 #include <cstddef>
+#include <filesystem>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <numeric>
 #include <cmath>
+#include <exception>
+#include <type_traits>
+#include <variant>
+
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <fmt/format.h>
 
+namespace {
+
+    // Read-only file descriptor for positional reads from several threads.
+    class PositionalReader
+    {
+    public:
+        explicit PositionalReader(const std::string& filename)
+            : fd_(::open(filename.c_str(), O_RDONLY))
+        {
+            if (fd_ < 0)
+                OPM_THROW(std::runtime_error, "Could not open file: '" + filename + "'");
+        }
+
+        ~PositionalReader() { ::close(fd_); }
+
+        PositionalReader(const PositionalReader&) = delete;
+        PositionalReader& operator=(const PositionalReader&) = delete;
+
+        void read(std::uint64_t offset, std::uint64_t length, std::vector<char>& buffer) const
+        {
+            buffer.resize(length);
+            std::uint64_t done = 0;
+
+            while (done < length) {
+                const auto n = ::pread(fd_, buffer.data() + done, length - done,
+                                       static_cast<off_t>(offset + done));
+                if (n < 0 && errno == EINTR)
+                    continue;
+
+                if (n <= 0)
+                    OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file");
+
+                done += static_cast<std::uint64_t>(n);
+            }
+        }
+
+    private:
+        int fd_;
+    };
+
+    using DecodedArray = std::variant<std::monostate,
+                                      std::vector<int>,
+                                      std::vector<float>,
+                                      std::vector<double>,
+                                      std::vector<bool>>;
+
+    template <typename T>
+    DecodedArray decodeNumeric(const char* begin, std::int64_t size)
+    {
+        return Opm::EclIO::detail::unpackBlocks<T>(begin, static_cast<std::size_t>(size));
+    }
+
+    // Number of Fortran blocks read at a time from an unmapped file.  Each
+    // thread then holds a raw buffer of a few hundred kilobytes besides the
+    // decoded array, instead of a raw copy of the whole array.
+    constexpr std::size_t blocksPerRead = 64;
+
+    template <typename T>
+    DecodedArray readNumeric(const PositionalReader& reader, std::uint64_t offset,
+                             std::int64_t size, Opm::EclIO::eclArrType type)
+    {
+        using Traits = Opm::EclIO::detail::ViewTraits<T>;
+        constexpr std::size_t elementsPerRead =
+            blocksPerRead * Traits::maxBlockSize / sizeof(typename Traits::Raw);
+
+        std::vector<T> result(static_cast<std::size_t>(size));
+        std::vector<char> buffer;
+
+        for (std::size_t first = 0; first < result.size(); first += elementsPerRead) {
+            const auto count = std::min(result.size() - first, elementsPerRead);
+            const auto length = Opm::EclIO::sizeOnDiskBinary(count, type, 0);
+
+            reader.read(offset, length, buffer);
+            Opm::EclIO::detail::unpackBlocks(buffer.data(), count, result, first);
+
+            offset += length;
+        }
+
+        return result;
+    }
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
+bool EclFile::loadIndex()
+{
+    const auto index = EclFileIndex::load(this->inputFilename);
+
+    if (!index)
+        return false;
+
+    const auto& entries = index->entries();
+    const auto n = entries.size();
+
+    array_name.reserve(n);
+    array_type.reserve(n);
+    array_size.reserve(n);
+    array_element_size.reserve(n);
+    ifStreamPos.reserve(n + 1);
+    arrayLoaded.reserve(n);
+
+    for (const auto& entry : entries) {
+        const int ind = array_name.size();
+
+        array_name.push_back(entry.name);
+        array_type.push_back(entry.type);
+        array_size.push_back(entry.size);
+        array_element_size.push_back(entry.elementSize);
+        ifStreamPos.push_back(entry.offset);
+
+        array_index[entry.name] = ind;
+
+        // scalar integer arrays (e.g., SEQNUM) are stored in the index itself
+        if ((entry.type == INTE) && (entry.size == 1)) {
+            inte_array[ind] = { entry.value };
+            arrayLoaded.push_back(true);
+        } else {
+            arrayLoaded.push_back(false);
+        }
+    }
+
+    this->ifStreamPos.push_back(std::filesystem::file_size(this->inputFilename));
+
+    return true;
+}
+
+
 void EclFile::load(bool preload) {
+    if (!formatted && this->loadIndex()) {
+        if (preload)
+            this->loadData();
+
+        return;
+    }
+
     std::fstream fileH;
 
     if (formatted) {
@@ -105,12 +247,27 @@ EclFile::EclFile(const std::string& filename, EclFile::Formatted fmt, bool prelo
 
 
 EclFile::EclFile(const std::string& filename, bool preload) :
+    EclFile(filename, MemoryMapped{false}, preload)
+{
+}
+
+
+EclFile::EclFile(const std::string& filename, EclFile::MemoryMapped mmap, bool preload) :
     inputFilename(filename)
 {
     if (!fileExists(filename))
         throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
 
     formatted = isFormatted(filename);
+
+    if (mmap.value) {
+        if (formatted)
+            OPM_THROW(std::invalid_argument,
+                      fmt::format("Memory mapped mode not supported for formatted file: {}", filename));
+
+        this->mapping = std::make_shared<const MappedFile>(filename);
+    }
+
     this->load(preload);
 }
 
@@ -119,18 +276,24 @@ void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
+    // numeric arrays are decoded directly from the mapped pages when available
+
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
+        inte_array[arrIndex] = mapping ? view<int>(arrIndex).to_vector()
+                                       : readBinaryInteArray(fileH, array_size[arrIndex]);
         break;
     case REAL:
-        real_array[arrIndex] = readBinaryRealArray(fileH, array_size[arrIndex]);
+        real_array[arrIndex] = mapping ? view<float>(arrIndex).to_vector()
+                                       : readBinaryRealArray(fileH, array_size[arrIndex]);
         break;
     case DOUB:
-        doub_array[arrIndex] = readBinaryDoubArray(fileH, array_size[arrIndex]);
+        doub_array[arrIndex] = mapping ? view<double>(arrIndex).to_vector()
+                                       : readBinaryDoubArray(fileH, array_size[arrIndex]);
         break;
     case LOGI:
-        logi_array[arrIndex] = readBinaryLogiArray(fileH, array_size[arrIndex]);
+        logi_array[arrIndex] = mapping ? view<bool>(arrIndex).to_vector()
+                                       : readBinaryLogiArray(fileH, array_size[arrIndex]);
         break;
     case CHAR:
         char_array[arrIndex] = readBinaryCharArray(fileH, array_size[arrIndex]);
@@ -148,6 +311,113 @@ void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
     arrayLoaded[arrIndex] = true;
 }
 
+void EclFile::loadBinaryArrays(const std::vector<int>& arrIndex)
+{
+    // Numeric arrays are read with positional reads, a bounded number of
+    // blocks at a time, or straight from the mapping, and decoded
+    // concurrently.  Results are stored serially, in the order of arrIndex,
+    // so the outcome is identical to loading each array through
+    // loadBinaryArray().
+
+    std::vector<int> numeric;
+    std::vector<int> other;
+
+    for (int ind : arrIndex) {
+        const auto type = array_type[ind];
+        if ((type == INTE) || (type == REAL) || (type == DOUB) || (type == LOGI)) {
+            numeric.push_back(ind);
+        } else {
+            other.push_back(ind);
+        }
+    }
+
+    std::vector<DecodedArray> decoded(numeric.size());
+    std::vector<std::exception_ptr> errors(numeric.size());
+
+    {
+        std::unique_ptr<PositionalReader> reader;
+        if (!mapping && !numeric.empty()) {
+            reader = std::make_unique<PositionalReader>(inputFilename);
+        }
+
+        const auto num = static_cast<int>(numeric.size());
+
+#pragma omp parallel for schedule(dynamic)
+        for (int n = 0; n < num; ++n) {
+            const int ind = numeric[n];
+
+            try {
+                if (!mapping) {
+                    const auto pos = ifStreamPos[ind];
+                    const auto size = array_size[ind];
+                    const auto type = array_type[ind];
+
+                    switch (type) {
+                    case INTE: decoded[n] = readNumeric<int>(*reader, pos, size, type); break;
+                    case REAL: decoded[n] = readNumeric<float>(*reader, pos, size, type); break;
+                    case DOUB: decoded[n] = readNumeric<double>(*reader, pos, size, type); break;
+                    default:   decoded[n] = readNumeric<bool>(*reader, pos, size, type); break;
+                    }
+
+                    continue;
+                }
+
+                const auto diskSize = sizeOnDiskBinary(array_size[ind], array_type[ind],
+                                                       array_element_size[ind]);
+
+                if (ifStreamPos[ind] + diskSize > mapping->size())
+                    OPM_THROW(std::runtime_error, "Array " + array_name[ind] +
+                              " extends beyond end of file " + inputFilename);
+
+                const char* begin = mapping->data() + ifStreamPos[ind];
+                mapping->willNeed(ifStreamPos[ind], diskSize);
+
+                switch (array_type[ind]) {
+                case INTE: decoded[n] = decodeNumeric<int>(begin, array_size[ind]); break;
+                case REAL: decoded[n] = decodeNumeric<float>(begin, array_size[ind]); break;
+                case DOUB: decoded[n] = decodeNumeric<double>(begin, array_size[ind]); break;
+                default:   decoded[n] = decodeNumeric<bool>(begin, array_size[ind]); break;
+                }
+            }
+            catch (...) {
+                errors[n] = std::current_exception();
+            }
+        }
+    }
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    for (std::size_t n = 0; n < numeric.size(); ++n) {
+        const int ind = numeric[n];
+
+        switch (array_type[ind]) {
+        case INTE: inte_array[ind] = std::move(std::get<std::vector<int>>(decoded[n])); break;
+        case REAL: real_array[ind] = std::move(std::get<std::vector<float>>(decoded[n])); break;
+        case DOUB: doub_array[ind] = std::move(std::get<std::vector<double>>(decoded[n])); break;
+        default:   logi_array[ind] = std::move(std::get<std::vector<bool>>(decoded[n])); break;
+        }
+
+        arrayLoaded[ind] = true;
+    }
+
+    if (!other.empty()) {
+        std::fstream fileH;
+        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+
+        if (!fileH) {
+            std::string message="Could not open file: '" + inputFilename +"'";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        for (int ind : other) {
+            loadBinaryArray(fileH, ind);
+        }
+    }
+}
+
 void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
 {
 
@@ -193,19 +463,10 @@ void EclFile::loadData()
 
     } else {
 
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        for (std::size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
-        }
+        std::vector<int> arrIndices(array_name.size());
+        std::iota(arrIndices.begin(), arrIndices.end(), 0);
 
-        fileH.close();
+        this->loadBinaryArrays(arrIndices);
     }
 }
 
@@ -279,19 +540,7 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         }
 
     } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        for (int ind : arrIndex) {
-            loadBinaryArray(fileH, ind);
-        }
-
-        fileH.close();
+        this->loadBinaryArrays(arrIndex);
     }
 }
 
@@ -644,6 +893,115 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
 }
 
 
+template <typename T>
+EclArrayView<T> EclFile::view(int arrIndex) const
+{
+    if (!mapping) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array views require memory mapped mode, file: {}", inputFilename));
+    }
+
+    if ((arrIndex < 0) || (arrIndex >= static_cast<int>(array_name.size()))) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Array index {} out of range, file: {}", arrIndex, inputFilename));
+    }
+
+    eclArrType type = INTE;
+    std::string typeStr = "integer";
+
+    if constexpr (std::is_same_v<T, float>) {
+        type = REAL;
+        typeStr = "float";
+    } else if constexpr (std::is_same_v<T, double>) {
+        type = DOUB;
+        typeStr = "double";
+    } else if constexpr (std::is_same_v<T, bool>) {
+        type = LOGI;
+        typeStr = "bool";
+    }
+
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    if (array_size[arrIndex] == 0)
+        return {};
+
+    if (ifStreamPos[arrIndex] + sizeOnDiskBinary(array_size[arrIndex], type, array_element_size[arrIndex]) > mapping->size()) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array {} extends beyond end of file: {}", array_name[arrIndex], inputFilename));
+    }
+
+    return { mapping, ifStreamPos[arrIndex], array_size[arrIndex] };
+}
+
+
+template <typename T>
+EclArrayView<T> EclFile::view(const std::string& name) const
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        std::string message="key '"+name + "' not found";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    return this->view<T>(search->second);
+}
+
+
+template EclArrayView<int> EclFile::view<int>(int) const;
+template EclArrayView<float> EclFile::view<float>(int) const;
+template EclArrayView<double> EclFile::view<double>(int) const;
+template EclArrayView<bool> EclFile::view<bool>(int) const;
+
+template EclArrayView<int> EclFile::view<int>(const std::string&) const;
+template EclArrayView<float> EclFile::view<float>(const std::string&) const;
+template EclArrayView<double> EclFile::view<double>(const std::string&) const;
+template EclArrayView<bool> EclFile::view<bool>(const std::string&) const;
+
+
+EclFileIndex EclFile::arrayIndex() const
+{
+    if (formatted) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array index not supported for formatted file: {}", inputFilename));
+    }
+
+    EclFileIndex index;
+
+    std::fstream fileH;
+
+    for (std::size_t i = 0; i < array_name.size(); i++) {
+        int value = 0;
+
+        if ((array_type[i] == INTE) && (array_size[i] == 1)) {
+            if (arrayLoaded[i]) {
+                value = inte_array.at(i).front();
+            } else {
+                if (!fileH.is_open())
+                    fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+
+                fileH.seekg(ifStreamPos[i], fileH.beg);
+                value = readBinaryInteArray(fileH, 1).front();
+            }
+        }
+
+        index.add({ array_name[i], array_type[i], array_element_size[i],
+                    array_size[i], ifStreamPos[i], value });
+    }
+
+    return index;
+}
+
+
+void EclFile::writeIndex() const
+{
+    this->arrayIndex().save(inputFilename);
+}
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
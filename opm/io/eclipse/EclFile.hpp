@@ -19,10 +19,13 @@
 #ifndef OPM_IO_ECLFILE_HPP
 #define OPM_IO_ECLFILE_HPP
 
+#include <opm/io/eclipse/EclArrayView.hpp>
+#include <opm/io/eclipse/EclFileIndex.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
 #include <ios>
 #include <map>
+#include <memory>
 #include <string>
 #include <stdexcept>
 #include <tuple>
@@ -39,9 +42,17 @@ public:
         bool value;
     };
 
+    // Request read access through a memory mapping of the file instead of
+    // file streams.  Only supported for unformatted files.
+    struct MemoryMapped {
+        bool value;
+    };
+
     explicit EclFile(const std::string& filename, bool preload = false);
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
+    EclFile(const std::string& filename, MemoryMapped mmap, bool preload = false);
     bool formattedInput() const { return formatted; }
+    bool memoryMapped() const { return static_cast<bool>(mapping); }
 
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
@@ -70,6 +81,13 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    // zero-copy access to numeric arrays (int, float, double, bool), requires memory mapped mode
+    template <typename T>
+    EclArrayView<T> view(int arrIndex) const;
+
+    template <typename T>
+    EclArrayView<T> view(const std::string& name) const;
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -77,6 +95,11 @@ public:
     std::size_t size() const;
     bool is_ix() const;
 
+    // array index of unformatted file, reused by subsequent EclFile objects on
+    // same file as long as file size and modification time are unchanged
+    EclFileIndex arrayIndex() const;
+    void writeIndex() const;
+
 protected:
     bool formatted;
     std::string inputFilename;
@@ -96,6 +119,8 @@ protected:
 
     std::map<std::string, int> array_index;
 
+    std::shared_ptr<const MappedFile> mapping;
+
     template<class T>
     const std::vector<T>& getImpl(int arrIndex, eclArrType type,
                                   const std::unordered_map<int, std::vector<T>>& array,
@@ -108,8 +133,10 @@ private:
     std::vector<bool> arrayLoaded;
 
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void loadBinaryArrays(const std::vector<int>& arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
     void load(bool preload);
+    bool loadIndex();
 
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
     std::vector<std::string> get_fmt_real_raw_str_values(int arrIndex) const;
@@ -0,0 +1,260 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/EclFileIndex.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+
+#include <fmt/format.h>
+
+namespace {
+
+    // On-disk layout, native byte order.  The magic string doubles as a
+    // version and byte order check.
+    //
+    //   header: magic[8] | numEntries u64 | fileSize u64 | mtime i64
+    //   entry:  name[8] | type i32 | elementSize i32 | size i64 | offset u64 | value i32 | reserved i32
+
+    constexpr std::array<char, 8> magic { 'O', 'P', 'M', 'E', 'I', 'D', 'X', '1' };
+
+    struct Header
+    {
+        std::array<char, 8> magic;
+        std::uint64_t numEntries;
+        std::uint64_t fileSize;
+        std::int64_t mtime;
+    };
+
+    struct RawEntry
+    {
+        std::array<char, 8> name;
+        std::int32_t type;
+        std::int32_t elementSize;
+        std::int64_t size;
+        std::uint64_t offset;
+        std::int32_t value;
+        std::int32_t reserved;
+    };
+
+    static_assert(sizeof(Header) == 32, "Unexpected padding in index header");
+    static_assert(sizeof(RawEntry) == 40, "Unexpected padding in index entry");
+
+    struct FileStamp
+    {
+        std::uint64_t size;
+        std::int64_t mtime;
+    };
+
+    std::optional<FileStamp> fileStamp(const std::string& filename)
+    {
+        std::error_code ec;
+
+        const auto size = std::filesystem::file_size(filename, ec);
+        if (ec)
+            return std::nullopt;
+
+        const auto mtime = std::filesystem::last_write_time(filename, ec);
+        if (ec)
+            return std::nullopt;
+
+        return FileStamp { static_cast<std::uint64_t>(size),
+                           static_cast<std::int64_t>(mtime.time_since_epoch().count()) };
+    }
+
+    std::uint64_t sidecarSize(std::size_t numEntries)
+    {
+        return sizeof(Header) + numEntries * sizeof(RawEntry);
+    }
+
+    RawEntry toRaw(const Opm::EclIO::EclFileIndex::Entry& entry)
+    {
+        RawEntry raw{};
+
+        raw.name.fill(' ');
+        std::copy_n(entry.name.begin(), std::min(entry.name.size(), raw.name.size()), raw.name.begin());
+
+        raw.type = static_cast<std::int32_t>(entry.type);
+        raw.elementSize = entry.elementSize;
+        raw.size = entry.size;
+        raw.offset = entry.offset;
+        raw.value = entry.value;
+
+        return raw;
+    }
+
+    Opm::EclIO::EclFileIndex::Entry fromRaw(const RawEntry& raw)
+    {
+        return {
+            Opm::EclIO::trimr(std::string(raw.name.begin(), raw.name.end())),
+            static_cast<Opm::EclIO::eclArrType>(raw.type),
+            raw.elementSize,
+            raw.size,
+            raw.offset,
+            raw.value
+        };
+    }
+
+    void writeEntries(std::ostream& os,
+                      std::vector<Opm::EclIO::EclFileIndex::Entry>::const_iterator begin,
+                      std::vector<Opm::EclIO::EclFileIndex::Entry>::const_iterator end)
+    {
+        std::vector<RawEntry> raw;
+        raw.reserve(std::distance(begin, end));
+
+        std::transform(begin, end, std::back_inserter(raw), toRaw);
+
+        os.write(reinterpret_cast<const char*>(raw.data()), raw.size() * sizeof(RawEntry));
+    }
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+std::string EclFileIndex::indexFileName(const std::string& filename)
+{
+    return filename + ".IDX";
+}
+
+
+std::optional<EclFileIndex> EclFileIndex::load(const std::string& filename)
+{
+    const auto idxName = indexFileName(filename);
+
+    std::ifstream is(idxName, std::ios::in | std::ios::binary);
+    if (!is)
+        return std::nullopt;
+
+    const auto stamp = fileStamp(filename);
+    if (!stamp)
+        return std::nullopt;
+
+    Header header;
+    if (!is.read(reinterpret_cast<char*>(&header), sizeof(header)) || (header.magic != magic))
+        return std::nullopt;
+
+    if ((header.fileSize != stamp->size) || (header.mtime != stamp->mtime))
+        return std::nullopt;
+
+    std::error_code ec;
+    if (std::filesystem::file_size(idxName, ec) != sidecarSize(header.numEntries) || ec)
+        return std::nullopt;
+
+    std::vector<RawEntry> raw(header.numEntries);
+    if (!is.read(reinterpret_cast<char*>(raw.data()), raw.size() * sizeof(RawEntry)))
+        return std::nullopt;
+
+    EclFileIndex index;
+    index.entries_.reserve(raw.size());
+
+    std::transform(raw.begin(), raw.end(), std::back_inserter(index.entries_), fromRaw);
+    index.persisted_ = index.entries_.size();
+
+    // The last array must end exactly at the end of the data file.
+    if (!index.entries_.empty()) {
+        const auto& last = index.entries_.back();
+
+        if (last.offset + sizeOnDiskBinary(last.size, last.type, last.elementSize) != stamp->size)
+            return std::nullopt;
+    }
+
+    return index;
+}
+
+
+void EclFileIndex::truncate(std::uint64_t fileSize)
+{
+    // Compare end of array data rather than data offset.  The data offset
+    // of an empty array, e.g., a message, coincides with the start of the
+    // next array's header which is a valid truncation point.
+    auto pos = std::find_if(this->entries_.begin(), this->entries_.end(),
+                            [fileSize](const Entry& entry)
+                            {
+                                return entry.offset
+                                    + sizeOnDiskBinary(entry.size, entry.type, entry.elementSize)
+                                    > fileSize;
+                            });
+
+    this->entries_.erase(pos, this->entries_.end());
+    this->persisted_ = std::min(this->persisted_, this->entries_.size());
+}
+
+
+void EclFileIndex::save(const std::string& filename)
+{
+    const auto stamp = fileStamp(filename);
+    if (!stamp)
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Can not determine size and modification time of {}", filename));
+
+    const auto header = Header { magic, this->entries_.size(), stamp->size, stamp->mtime };
+    const auto idxName = indexFileName(filename);
+
+    std::error_code ec;
+    const auto currentSize = std::filesystem::file_size(idxName, ec);
+
+    if ((this->persisted_ > 0) && !ec && (currentSize >= sidecarSize(this->persisted_))) {
+        // Append new entries, then update header.  Concurrent readers see
+        // either the old or the new header, and will reject the old one
+        // since it no longer matches the data file.
+        std::fstream os(idxName, std::ios::in | std::ios::out | std::ios::binary);
+
+        if (os) {
+            os.seekp(sidecarSize(this->persisted_));
+            writeEntries(os, this->entries_.begin() + this->persisted_, this->entries_.end());
+
+            os.seekp(0);
+            os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            os.close();
+
+            if (os) {
+                std::filesystem::resize_file(idxName, sidecarSize(this->entries_.size()));
+                this->persisted_ = this->entries_.size();
+                return;
+            }
+        }
+    }
+
+    // Full rewrite through a temporary file, such that readers never
+    // observe a partially written index.
+    const auto tmpName = idxName + ".tmp";
+    {
+        std::ofstream os(tmpName, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeEntries(os, this->entries_.begin(), this->entries_.end());
+
+        if (!os)
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Failed to write array index file {}", tmpName));
+    }
+
+    std::filesystem::rename(tmpName, idxName);
+    this->persisted_ = this->entries_.size();
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,86 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLFILEINDEX_HPP
+#define OPM_IO_ECLFILEINDEX_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Persistent index of the arrays in an unformatted ECLIPSE file.
+///
+/// The index is stored in a sidecar file next to the data file (see
+/// indexFileName()) and records name, type, size and data offset of every
+/// array.  The value of every scalar INTE array, e.g., SEQNUM, is stored
+/// as well such that report step ranges of unified restart files can be
+/// established without touching the data file.
+///
+/// The sidecar is stamped with the size and modification time of the data
+/// file and is only used if both match.  Entries can be appended to an
+/// existing sidecar without rewriting it.
+class EclFileIndex
+{
+public:
+    struct Entry
+    {
+        std::string name;
+        eclArrType type;
+        int elementSize;
+        std::int64_t size;
+        std::uint64_t offset;  // position of first data block, i.e., just after the array header
+        int value;             // value of scalar INTE arrays, zero otherwise
+    };
+
+    static std::string indexFileName(const std::string& filename);
+
+    /// Load index of \p filename.  Returns nullopt if the sidecar does not
+    /// exist, is corrupt, or does not match the current data file.
+    static std::optional<EclFileIndex> load(const std::string& filename);
+
+    void add(Entry entry) { this->entries_.push_back(std::move(entry)); }
+
+    /// Drop all entries whose array data extends beyond \p fileSize.  An
+    /// empty array, e.g., a message, ending exactly at \p fileSize is kept.
+    void truncate(std::uint64_t fileSize);
+
+    /// Write index for \p filename, stamped with the data file's current
+    /// size and modification time.  Only entries added since the last
+    /// load() or save() are written if the sidecar is already up to date
+    /// with respect to those.
+    void save(const std::string& filename);
+
+    const std::vector<Entry>& entries() const { return this->entries_; }
+    std::size_t size() const { return this->entries_.size(); }
+
+private:
+    std::vector<Entry> entries_{};
+
+    // number of leading entries already present in the sidecar file
+    std::size_t persisted_{0};
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLFILEINDEX_HPP
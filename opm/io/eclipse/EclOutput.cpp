@@ -17,6 +17,7 @@
    */
 
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ByteSwap.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
@@ -25,12 +26,14 @@
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
 #include <ios>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 #include <typeinfo>
 
 namespace Opm { namespace EclIO {
@@ -249,6 +252,44 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
+    if constexpr (std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>) {
+        // Assemble groups of complete blocks, record markers included, in
+        // a staging buffer and convert the payload of each block in bulk.
+        constexpr int blocksPerWrite = 256;
+
+        std::vector<char> buffer;
+        buffer.reserve(blocksPerWrite * (maxBlockSize + 2*sizeof(int)));
+
+        for (offset = 0; offset < size; offset += num) {
+            num = static_cast<int>(std::min<int64_t>(size - offset, maxNumberOfElements));
+
+            const int nbytes = num * sizeOfElement;
+            const auto pos = buffer.size();
+
+            buffer.resize(pos + nbytes + 2*sizeof(int));
+            char* block = buffer.data() + pos;
+
+            dhead = flipEndianInt(nbytes);
+            std::memcpy(block, &dhead, sizeof(dhead));
+
+            if constexpr (sizeof(T) == 8) {
+                byteSwap64(data.data() + offset, block + sizeof(dhead), num);
+            } else {
+                byteSwap32(data.data() + offset, block + sizeof(dhead), num);
+            }
+
+            std::memcpy(block + sizeof(dhead) + nbytes, &dhead, sizeof(dhead));
+
+            if (buffer.size() + maxBlockSize + 2*sizeof(int) > buffer.capacity()) {
+                ofileH.write(buffer.data(), buffer.size());
+                buffer.clear();
+            }
+        }
+
+        ofileH.write(buffer.data(), buffer.size());
+        return;
+    }
+
     int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
 
     rest = size * static_cast<int64_t>(sizeOfElement);
@@ -268,37 +309,7 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
-        if (arrType == INTE) {
-
-            std::vector<int> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianInt(data[m + offset]);
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
-
-        } else if (arrType == REAL) {
-
-            std::vector<float> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianFloat(data[m + offset]);
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
-
-        } else if (arrType == DOUB) {
-
-            std::vector<double> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianDouble(data[m + offset]);
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
-
-        } else if (arrType == LOGI) {
+        if (arrType == LOGI) {
 
             std::vector<int> logi_data;
             logi_data.resize(num, 0);
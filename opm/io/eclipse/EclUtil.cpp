@@ -18,17 +18,20 @@
 */
 
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/ByteSwap.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -214,6 +217,40 @@ std::string Opm::EclIO::trimr(const std::string &str1)
     }
 }
 
+Opm::time_point Opm::EclIO::summaryStartDate(const std::vector<int>& datetime)
+{
+    auto day = datetime[0];
+    auto month = datetime[1];
+    auto year = datetime[2];
+    auto hour = 0;
+    auto minute = 0;
+    auto second = 0;
+
+    if (datetime.size() == 7) {
+        hour = datetime[3];
+        minute = datetime[4];
+        auto total_usec = datetime[5];
+        second = total_usec / 1000000;
+    }
+
+    const auto ts = Opm::TimeStampUTC{ Opm::TimeStampUTC::YMD{ year, month, day}}.hour(hour).minutes(minute).seconds(second);
+    return Opm::TimeService::from_time_t( Opm::asTimeT(ts) );
+}
+
+
+bool Opm::EclIO::tryRepeatedly(const std::function<bool()>& attempt, int maxAttempts)
+{
+    for (int n = 1; n < maxAttempts; n++) {
+        if (attempt())
+            return true;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    return attempt();
+}
+
+
 std::uint64_t Opm::EclIO::sizeOnDiskBinary(std::int64_t num, Opm::EclIO::eclArrType arrType, int elementSize)
 {
     std::uint64_t size = 0;
@@ -505,24 +542,92 @@ std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const std::int64
 }
 
 
+// The numeric readers below no longer go through readBinaryArray(), so the
+// instantiation used by ESmry must be explicit.
+template std::vector<int>
+Opm::EclIO::readBinaryArray<int,int>(std::fstream&, const std::int64_t, Opm::EclIO::eclArrType,
+                                     std::function<int(int)>&, int);
+
+
+namespace {
+
+// Read each block of a numeric array directly into its final position in
+// the result, checking the record markers, and convert the block to native
+// byte order while it is still in cache.  No intermediate copy of the
+// array is made.
+template<typename T>
+std::vector<T> readBinaryNumericArray(std::fstream& fileH, const std::int64_t size,
+                                      Opm::EclIO::eclArrType type)
+{
+    const auto [sizeOfElement, maxBlockSize] = Opm::EclIO::block_size_data_binary(type);
+    const std::int64_t maxNumberOfElements = maxBlockSize / sizeOfElement;
+
+    std::vector<T> arr(size);
+    T* dest = arr.data();
+
+    std::int64_t rest = size;
+
+    while (rest > 0) {
+        const int num = static_cast<int>(std::min(rest, maxNumberOfElements));
+        const int nbytes = num * sizeOfElement;
+
+        int dhead;
+        fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dhead = Opm::EclIO::flipEndianInt(dhead);
+
+        if (!fileH) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file");
+        }
+
+        if (dhead != nbytes) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+        }
+
+        fileH.read(reinterpret_cast<char*>(dest), nbytes);
+
+        int dtail;
+        fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+        dtail = Opm::EclIO::flipEndianInt(dtail);
+
+        if (!fileH) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file");
+        }
+
+        if (dhead != dtail) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+        }
+
+        if constexpr (sizeof(T) == 8) {
+            Opm::EclIO::byteSwap64(dest, dest, num);
+        } else {
+            Opm::EclIO::byteSwap32(dest, dest, num);
+        }
+
+        rest -= num;
+        dest += num;
+    }
+
+    return arr;
+}
+
+} // Anonymous namespace
+
+
 std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
+    return readBinaryNumericArray<int>(fileH, size, Opm::EclIO::INTE);
 }
 
 
 std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
+    return readBinaryNumericArray<float>(fileH, size, Opm::EclIO::REAL);
 }
 
 
 std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
+    return readBinaryNumericArray<double>(fileH, size, Opm::EclIO::DOUB);
 }
 
 std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const std::int64_t size)
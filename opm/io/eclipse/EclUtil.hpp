@@ -21,6 +21,7 @@
 #define OPM_IO_ECLUTIL_HPP
 
 #include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/common/utility/TimeService.hpp>
 
 #include <cstdint>
 #include <functional>
@@ -55,6 +56,17 @@ namespace Opm { namespace EclIO {
 
     std::string trimr(const std::string &str1);
 
+    /// Start date of an ESMRY or CSMRY summary file from its START array,
+    /// i.e., day, month and year, plus hour, minute and microseconds if the
+    /// array has seven elements.
+    time_point summaryStartDate(const std::vector<int>& datetime);
+
+    /// Call \p attempt until it returns true, at most \p maxAttempts
+    /// times with a short pause in between.  Used when reading summary
+    /// files which an active run may be writing.  Returns whether one of
+    /// the attempts succeeded.
+    bool tryRepeatedly(const std::function<bool()>& attempt, int maxAttempts = 10);
+
     std::uint64_t sizeOnDiskBinary(std::int64_t num, Opm::EclIO::eclArrType arrType, int elementSize);
     std::uint64_t sizeOnDiskFormatted(const std::int64_t num, Opm::EclIO::eclArrType arrType, int elementSize);
 
@@ -21,6 +21,7 @@
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/utility/TimeService.hpp>
 #include <opm/common/utility/shmatch.hpp>
+#include <opm/io/eclipse/ByteSwap.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 
@@ -33,28 +34,42 @@
 #include <iterator>
 #include <stdexcept>
 #include <string>
-#include <thread>
 
 namespace {
 
-Opm::time_point make_date(const std::vector<int>& datetime) {
-    auto day = datetime[0];
-    auto month = datetime[1];
-    auto year = datetime[2];
-    auto hour = 0;
-    auto minute = 0;
-    auto second = 0;
-
-    if (datetime.size() == 7) {
-        hour = datetime[3];
-        minute = datetime[4];
-        auto total_usec = datetime[5];
-        second = total_usec / 1000000;
+// Elements [from, to) of binary INTE or REAL array with data starting at
+// dataPos, skipping the record markers between blocks.
+template <typename T>
+std::vector<T> readBinaryRange(std::fstream& fileH, const uint64_t dataPos,
+                               const size_t from, const size_t to)
+{
+    static_assert(sizeof(T) == Opm::EclIO::sizeOfInte);
+
+    constexpr auto blockBytes = static_cast<uint64_t>(Opm::EclIO::MaxBlockSizeInte);
+    constexpr auto blockSize = blockBytes / sizeof(T);
+
+    std::vector<T> result(to - from);
+
+    for (size_t elm = from; elm < to;) {
+        const auto block = elm / blockSize;
+        const auto num = std::min(to, (block + 1) * blockSize) - elm;
+
+        const auto pos = dataPos + Opm::EclIO::sizeOfInte
+            + block * (blockBytes + 2 * Opm::EclIO::sizeOfInte)
+            + (elm % blockSize) * sizeof(T);
+
+        fileH.seekg(pos, fileH.beg);
+        fileH.read(reinterpret_cast<char*>(result.data() + (elm - from)), num * sizeof(T));
+
+        elm += num;
     }
 
+    if (!fileH)
+        throw std::runtime_error("Error reading binary data, unexpected end of file");
 
-    const auto ts = Opm::TimeStampUTC{ Opm::TimeStampUTC::YMD{ year, month, day}}.hour(hour).minutes(minute).seconds(second);
-    return Opm::TimeService::from_time_t( Opm::asTimeT(ts) );
+    Opm::EclIO::byteSwap32(result.data(), result.data(), result.size());
+
+    return result;
 }
 
 
@@ -112,16 +127,12 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
     uint64_t rstep_offset;
 
-    bool res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
-    int n_attempts = 1;
-
-    while ((!res) && (n_attempts < 10)){
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
-        n_attempts ++;
-    }
+    const bool res = tryRepeatedly([&]()
+    {
+        return open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
+    });
 
-    if (n_attempts == 10)
+    if (!res)
         OPM_THROW( std::runtime_error, "when opening ESMRY file " + filename );
 
     m_startdat = std::get<0>(ext_esmry_head);
@@ -267,6 +278,117 @@ bool ExtESmry::all_steps_available()
     return true;
 }
 
+size_t ExtESmry::refresh()
+{
+    auto start = std::chrono::system_clock::now();
+
+    size_t num_new = 0;
+
+    const bool res = tryRepeatedly([this, &num_new]()
+    {
+        return this->refresh_esmry(num_new);
+    });
+
+    if (!res)
+        OPM_THROW( std::runtime_error, "when refreshing ESMRY file " + m_esmry_files[0].string() );
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+
+    return num_new;
+}
+
+bool ExtESmry::refresh_esmry(size_t& num_new)
+{
+    // The ESMRY file of an active run is replaced as a whole on each
+    // update, but the header part up to RSTEP does not change.  Only the
+    // active run, i.e., the first ESMRY file, is extended.
+
+    num_new = 0;
+
+    std::fstream fileH;
+
+    fileH.open(m_esmry_files[0], std::ios::in |  std::ios::binary);
+
+    if (!fileH)
+        return false;
+
+    std::string arrName;
+    Opm::EclIO::eclArrType arrType;
+    int64_t num_tstep;
+    int sizeOfElement;
+
+    fileH.seekg (m_rstep_offset[0], fileH.beg);
+
+    try {
+        Opm::EclIO::readBinaryHeader(fileH, arrName, num_tstep, arrType, sizeOfElement);
+    } catch (const std::runtime_error& error)
+    {
+        return false;
+    }
+
+    if ((arrName != "RSTEP   ") or (arrType != Opm::EclIO::INTE))
+        OPM_THROW(std::invalid_argument, "Reading RSTEP, invalid esmry file " + m_esmry_files[0].string() );
+
+    const size_t n_old = m_nTstep_v[0];
+    const size_t n_new = static_cast<size_t>(num_tstep);
+
+    if (n_new <= n_old)
+        return true;
+
+    const uint64_t header_size = 24;
+    const uint64_t inte_arr_size = header_size + sizeOnDiskBinary(num_tstep, Opm::EclIO::INTE, sizeOfInte);
+    const uint64_t real_arr_size = header_size + sizeOnDiskBinary(num_tstep, Opm::EclIO::REAL, sizeOfReal);
+
+    const uint64_t rstep_pos = m_rstep_offset[0] + header_size;
+    const uint64_t tstep_pos = rstep_pos + inte_arr_size;
+    const uint64_t vect_pos = m_rstep_offset[0] + 2 * inte_arr_size + header_size;
+
+    std::vector<int> rstep, tstep;
+    std::vector<int> loadKeyIndex;
+    std::vector<std::vector<float>> smry_data;
+
+    try {
+        rstep = readBinaryRange<int>(fileH, rstep_pos, n_old, n_new);
+        tstep = readBinaryRange<int>(fileH, tstep_pos, n_old, n_new);
+
+        for (size_t kind = 0; kind < m_nVect; kind++) {
+            if (!m_vectorLoaded[kind])
+                continue;
+
+            const auto key_ind = static_cast<uint64_t>(m_keyword_index[0].at(m_keyword[kind]));
+
+            loadKeyIndex.push_back(kind);
+            smry_data.push_back(readBinaryRange<float>(fileH, vect_pos + key_ind * real_arr_size, n_old, n_new));
+        }
+    } catch (const std::runtime_error& error)
+    {
+        return false;
+    }
+
+    fileH.close();
+
+    for (size_t n = 0; n < loadKeyIndex.size(); n++)
+        m_vectorData[loadKeyIndex[n]].insert(m_vectorData[loadKeyIndex[n]].end(), smry_data[n].begin(), smry_data[n].end());
+
+    for (size_t n = 0; n < rstep.size(); n++)
+        if (rstep[n] == 1)
+            m_seqIndex.push_back(m_nTstep + n);
+
+    m_rstep_v[0].insert(m_rstep_v[0].end(), rstep.begin(), rstep.end());
+    m_tstep_v[0].insert(m_tstep_v[0].end(), tstep.begin(), tstep.end());
+    m_rstep.insert(m_rstep.end(), rstep.begin(), rstep.end());
+    m_tstep.insert(m_tstep.end(), tstep.begin(), tstep.end());
+
+    m_nTstep_v[0] = n_new;
+    m_tstep_range[0] = std::make_tuple(0, static_cast<int>(n_new) - 1);
+    m_nTstep = m_rstep.size();
+
+    num_new = n_new - n_old;
+
+    return true;
+}
+
 bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, uint64_t& rstep_offset)
 {
     std::fstream fileH;
@@ -299,7 +421,7 @@ bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHea
         return false;
     }
 
-    auto startdat = make_date(m_start_vect);
+    auto startdat = summaryStartDate(m_start_vect);
 
     try {
        Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
@@ -542,17 +664,12 @@ void ExtESmry::loadData(const std::vector<std::string>& stringVect)
 
         int to_ind = std::get<1>(m_tstep_range[ind]);
 
-        bool res = load_esmry(stringVect, keyIndexVect, loadKeyIndex, ind, to_ind );
-
-        int n_attempts = 1;
-
-        while ((!res) && (n_attempts < 10)){
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            res = load_esmry(stringVect, keyIndexVect, loadKeyIndex, ind, to_ind );
-            n_attempts ++;
-        }
+        const bool res = tryRepeatedly([&]()
+        {
+            return load_esmry(stringVect, keyIndexVect, loadKeyIndex, ind, to_ind );
+        });
 
-        if (n_attempts == 10){
+        if (!res){
             std::string emsry_file_name = m_esmry_files[ind].string();
             OPM_THROW( std::runtime_error, "when loading data from ESMRY file" + emsry_file_name );
         }
@@ -67,6 +67,12 @@ public:
     std::vector<time_point> dates();
 
     bool all_steps_available();
+
+    // Pick up time steps added to the ESMRY file of an active run since
+    // construction or the previous call to refresh().  Only the new part
+    // of each loaded vector is read.  Returns the number of new time steps.
+    size_t refresh();
+
     std::string rootname() { return m_inputFileName.stem().generic_string(); }
     std::tuple<double, double> get_io_elapsed() const;
 
@@ -104,6 +110,8 @@ private:
     bool load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind );
 
+    bool refresh_esmry(size_t& num_new);
+
     void updatePathAndRootName(std::filesystem::path& dir, std::filesystem::path& rootN);
 };
 
@@ -0,0 +1,97 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+namespace Opm { namespace EclIO {
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Can not open file {} for memory mapping: {}",
+                              filename, std::strerror(errno)));
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        const auto err = errno;
+        ::close(fd);
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Can not determine size of file {}: {}",
+                              filename, std::strerror(err)));
+    }
+
+    this->m_size = static_cast<std::uint64_t>(st.st_size);
+
+    // mmap() does not accept zero length mappings.  An empty file has no
+    // arrays to read, so leave m_data as nullptr in that case.
+    if (this->m_size > 0) {
+        void* addr = ::mmap(nullptr, this->m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            const auto err = errno;
+            ::close(fd);
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Memory mapping of file {} failed: {}",
+                                  filename, std::strerror(err)));
+        }
+
+        this->m_data = static_cast<const char*>(addr);
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (this->m_data != nullptr) {
+        ::munmap(const_cast<char*>(this->m_data), this->m_size);
+    }
+}
+
+void MappedFile::willNeed(std::uint64_t offset, std::uint64_t length) const
+{
+    if ((this->m_data == nullptr) || (offset >= this->m_size)) {
+        return;
+    }
+
+    // madvise() requires a page aligned start address.
+    const auto page = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+    const auto start = offset - (offset % page);
+    const auto end = std::min(offset + length, this->m_size);
+
+    ::madvise(const_cast<char*>(this->m_data) + start, end - start, MADV_WILLNEED);
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,56 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_MAPPEDFILE_HPP
+#define OPM_IO_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Opm { namespace EclIO {
+
+/// Read-only memory mapping of an entire file.
+///
+/// Pages are brought in by the operating system on first access, so the
+/// resident memory of a mapped file only reflects the regions that have
+/// actually been touched.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return this->m_data; }
+    std::uint64_t size() const { return this->m_size; }
+
+    /// Hint to the operating system that the byte range [offset,
+    /// offset+length) will be read in the near future.
+    void willNeed(std::uint64_t offset, std::uint64_t length) const;
+
+private:
+    const char* m_data = nullptr;
+    std::uint64_t m_size = 0;
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_MAPPEDFILE_HPP
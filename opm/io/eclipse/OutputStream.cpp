@@ -21,21 +21,26 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 
+#include <opm/io/eclipse/EclFileIndex.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <ios>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -204,6 +209,58 @@ namespace {
             }
         } // namespace Smspec
     } // namespace Open
+
+    namespace Index
+    {
+        /// Array type and element size of output vector, matching the
+        /// choices made by EclOutput::write().
+        template <typename T>
+        std::pair<Opm::EclIO::eclArrType, int>
+        arrayType(const std::vector<T>& data)
+        {
+            using Opm::EclIO::eclArrType;
+
+            if constexpr (std::is_same_v<T, int>) {
+                return { eclArrType::INTE, Opm::EclIO::sizeOfInte };
+            }
+            else if constexpr (std::is_same_v<T, float>) {
+                return { eclArrType::REAL, Opm::EclIO::sizeOfReal };
+            }
+            else if constexpr (std::is_same_v<T, double>) {
+                return { eclArrType::DOUB, Opm::EclIO::sizeOfDoub };
+            }
+            else if constexpr (std::is_same_v<T, bool>) {
+                return { eclArrType::LOGI, Opm::EclIO::sizeOfLogi };
+            }
+            else if constexpr (std::is_same_v<T, std::string>) {
+                auto maxLength = std::size_t{0};
+                for (const auto& s : data) {
+                    maxLength = std::max(maxLength, s.size());
+                }
+
+                if (maxLength > static_cast<std::size_t>(Opm::EclIO::sizeOfChar)) {
+                    return { eclArrType::C0NN, static_cast<int>(maxLength) };
+                }
+
+                return { eclArrType::CHAR, Opm::EclIO::sizeOfChar };
+            }
+            else if constexpr (std::is_same_v<T, Opm::EclIO::PaddedOutputString<8>>) {
+                return { eclArrType::CHAR, Opm::EclIO::sizeOfChar };
+            }
+            else {
+                return { eclArrType::MESS, Opm::EclIO::sizeOfInte };
+            }
+        }
+
+        /// Size of binary array header, including record markers.
+        std::uint64_t headerSize(const std::size_t numElements)
+        {
+            // Arrays with more than 2^31-1 elements use an additional X231
+            // header.
+            return (numElements > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+                ? 48 : 24;
+        }
+    } // namespace Index
 } // Anonymous namespace
 
 // =====================================================================
@@ -288,48 +345,84 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 // =====================================================================
 
 Opm::EclIO::OutputStream::Restart::
-Restart(const ResultSet& rset,
-        const int        seqnum,
-        const Formatted& fmt,
-        const Unified&   unif)
+Restart(const ResultSet&  rset,
+        const int         seqnum,
+        const Formatted&  fmt,
+        const Unified&    unif,
+        const ArrayIndex& index)
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
 
-    const auto fname = outputFileName(rset, ext);
+    this->fname_ = outputFileName(rset, ext);
+
+    // The array index is only supported for unformatted files.  Keep an
+    // existing index up to date even if not explicitly requested, lest it
+    // be silently invalidated by this output step.
+    const auto maintainIndex = !fmt.set &&
+        (index.set || std::filesystem::exists(EclFileIndex::indexFileName(this->fname_)));
 
     if (unif.set) {
         // Run uses unified restart files.
-        this->openUnified(fname, fmt.set, seqnum);
+        this->openUnified(this->fname_, fmt.set, seqnum, maintainIndex);
 
         // Write SEQNUM value to stream to start new output sequence.
-        this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
+        this->write("SEQNUM", std::vector<int>{ seqnum });
     }
     else {
         // Run uses separate, not unified, restart files.  Create a
         // new output file and open an output stream on it.
-        this->openNew(fname, fmt.set);
+        this->openNew(this->fname_, fmt.set);
+
+        if (maintainIndex) {
+            this->index_ = std::make_unique<EclFileIndex>();
+        }
     }
 }
 
 Opm::EclIO::OutputStream::Restart::~Restart()
-{}
+{
+    if ((this->index_ == nullptr) || (this->stream_ == nullptr)) {
+        return;
+    }
+
+    // Index must be stamped with the final size of the restart file.
+    try {
+        this->stream_->flushStream();
+        this->index_->save(this->fname_);
+    }
+    catch (const std::exception& e) {
+        OpmLog::warning("Failed to update array index of restart file '"
+                        + this->fname_ + "': " + e.what());
+    }
+}
 
 Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
     : stream_{ std::move(rhs.stream_) }
+    , fname_ { std::move(rhs.fname_) }
+    , index_ { std::move(rhs.index_) }
 {}
 
 Opm::EclIO::OutputStream::Restart&
 Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
 {
     this->stream_ = std::move(rhs.stream_);
+    this->fname_  = std::move(rhs.fname_);
+    this->index_  = std::move(rhs.index_);
 
     return *this;
 }
 
 void Opm::EclIO::OutputStream::Restart::message(const std::string& msg)
 {
+    const auto start = (this->index_ != nullptr)
+        ? this->stream().ofileH.tellp() : std::streampos{};
+
     this->stream().message(msg);
+
+    if (this->index_ != nullptr) {
+        this->recordIndexEntry(msg, std::vector<char>{}, start);
+    }
 }
 
 void
@@ -379,7 +472,8 @@ void
 Opm::EclIO::OutputStream::Restart::
 openUnified(const std::string& fname,
             const bool         formatted,
-            const int          seqnum)
+            const int          seqnum,
+            const bool         maintainIndex)
 {
     // Determine if we're creating a new output/restart file or
     // if we're opening an existing one, possibly at a specific
@@ -389,6 +483,10 @@ openUnified(const std::string& fname,
     if (rst == nullptr) {
         // No such unified restart file exists.  Create new file.
         this->openNew(fname, formatted);
+
+        if (maintainIndex) {
+            this->index_ = std::make_unique<EclFileIndex>();
+        }
     }
     else if (! rst->hasKey("SEQNUM")) {
         // File with correct filename exists but does not appear
@@ -403,8 +501,23 @@ openUnified(const std::string& fname,
         // Restart file exists and appears to be a unified restart
         // resource.  Open writable restart stream backed by the
         // specific file.
-        this->openExisting(fname, formatted,
-                           rst->restartStepWritePosition(seqnum));
+        const auto writePos = rst->restartStepWritePosition(seqnum);
+
+        this->openExisting(fname, formatted, writePos);
+
+        if (maintainIndex) {
+            // Prefer the persisted index, if current, since that allows
+            // appending to the index file rather than rewriting it.
+            auto index = EclFileIndex::load(fname);
+
+            this->index_ = index.has_value()
+                ? std::make_unique<EclFileIndex>(std::move(*index))
+                : std::make_unique<EclFileIndex>(rst->arrayIndex());
+
+            if (writePos != std::streampos(-1)) {
+                this->index_->truncate(static_cast<std::uint64_t>(std::streamoff{writePos}));
+            }
+        }
     }
 }
 
@@ -428,7 +541,10 @@ openExisting(const std::string&   fname,
         // No specified initial write position.  Typically the case if
         // requested SEQNUM value exceeds all existing SEQNUM values in
         // 'fname'.  This is effectively a simple append operation so
-        // no further actions required.
+        // no further actions required, except placing the output
+        // indicator at the end of the file such that tellp() reports
+        // actual write positions.
+        this->stream_->ofileH.seekp(0, std::ios_base::end);
         return;
     }
 
@@ -466,7 +582,36 @@ namespace Opm { namespace EclIO { namespace OutputStream {
     void Restart::writeImpl(const std::string&    kw,
                             const std::vector<T>& data)
     {
+        const auto start = (this->index_ != nullptr)
+            ? this->stream().ofileH.tellp() : std::streampos{};
+
         this->stream().write(kw, data);
+
+        if (this->index_ != nullptr) {
+            this->recordIndexEntry(kw, data, start);
+        }
+    }
+
+    template <typename T>
+    void Restart::recordIndexEntry(const std::string&    kw,
+                                   const std::vector<T>& data,
+                                   const std::streampos  start)
+    {
+        const auto [type, elementSize] = Index::arrayType(data);
+
+        const auto offset = static_cast<std::uint64_t>(std::streamoff{start})
+            + Index::headerSize(data.size());
+
+        // Scalar integer arrays, e.g., SEQNUM, carry their value.
+        auto value = 0;
+        if constexpr (std::is_same_v<T, int>) {
+            if (data.size() == 1) {
+                value = data.front();
+            }
+        }
+
+        this->index_->add({ kw, type, elementSize,
+                            static_cast<std::int64_t>(data.size()), offset, value });
     }
 
 }}}
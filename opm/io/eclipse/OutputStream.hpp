@@ -32,14 +32,16 @@
 
 namespace Opm { namespace EclIO {
 
+    class EclFileIndex;
     class EclOutput;
 
 }} // namespace Opm::EclIO
 
 namespace Opm { namespace EclIO { namespace OutputStream {
 
-    struct Formatted { bool set; };
-    struct Unified   { bool set; };
+    struct Formatted  { bool set; };
+    struct Unified    { bool set; };
+    struct ArrayIndex { bool set; };
 
     /// Abstract representation of an ECLIPSE-style result set.
     struct ResultSet
@@ -152,10 +154,15 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] fmt Whether or not to create formatted output files.
         ///
         /// \param[in] unif Whether or not to create unified output files.
-        explicit Restart(const ResultSet& rset,
-                         const int        seqnum,
-                         const Formatted& fmt,
-                         const Unified&   unif);
+        ///
+        /// \param[in] index Whether or not to maintain a persistent array
+        ///    index (see EclFileIndex) next to unformatted output files.
+        ///    An existing index is always kept up to date.
+        explicit Restart(const ResultSet&  rset,
+                         const int         seqnum,
+                         const Formatted&  fmt,
+                         const Unified&    unif,
+                         const ArrayIndex& index = ArrayIndex{false});
 
         ~Restart();
 
@@ -226,6 +233,13 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// Restart output stream.
         std::unique_ptr<EclOutput> stream_;
 
+        /// Name of restart output file.
+        std::string fname_{};
+
+        /// Array index of restart output file.  Null unless the index
+        /// is being maintained.
+        std::unique_ptr<EclFileIndex> index_{};
+
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
         ///
@@ -238,9 +252,13 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] seqnum Sequence number of new report.  One-based
         ///    report step ID.
+        ///
+        /// \param[in] maintainIndex Whether or not to set up \c index_
+        ///    for the output file.
         void openUnified(const std::string& fname,
                          const bool         formatted,
-                         const int          seqnum);
+                         const int          seqnum,
+                         const bool         maintainIndex);
 
         /// Open new output stream.
         ///
@@ -277,6 +295,18 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         template <typename T>
         void writeImpl(const std::string&    kw,
                        const std::vector<T>& data);
+
+        /// Add array written at stream position \p start to index_.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        ///
+        /// \param[in] start Stream position of array header.
+        template <typename T>
+        void recordIndexEntry(const std::string&    kw,
+                              const std::vector<T>& data,
+                              const std::streampos  start);
     };
 
     /// File manager for RFT output streams
@@ -31,9 +31,13 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 
 #include <opm/input/eclipse/Units/Dimension.hpp>
@@ -53,19 +57,28 @@
 #include <opm/common/utility/String.hpp>
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
 #include <cctype>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <functional>
 #include <limits>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <utility>    // move
 #include <vector>
 
+#include <fmt/format.h>
+
 namespace {
 
 void ensure_directory_exists(const std::filesystem::path& odir)
@@ -95,6 +108,147 @@ void ensure_directory_exists(const std::filesystem::path& odir)
     }
 }
 
+/// Single background thread executing output jobs in submission order.
+///
+/// At most max_pending jobs are queued at any time; push() blocks the
+/// caller until the writer has caught up.  The first exception raised by a
+/// job is kept and rethrown to the caller from push() or wait(), and any
+/// jobs queued behind the failing one are discarded.  An error which has not
+/// been collected by wait() before destruction is dropped.
+class OutputQueue
+{
+public:
+    explicit OutputQueue(const std::size_t max_pending)
+        : max_pending_ { max_pending }
+        , worker_      { [this]() { this->run(); } }
+    {}
+
+    OutputQueue(const OutputQueue&) = delete;
+    OutputQueue& operator=(const OutputQueue&) = delete;
+
+    ~OutputQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock { this->mutex_ };
+            this->stop_ = true;
+        }
+
+        this->job_available_.notify_one();
+        this->worker_.join();
+
+        // Nobody is left to rethrow an error of the last jobs.
+        if (this->error_) {
+            try {
+                std::rethrow_exception(this->error_);
+            }
+            catch (const std::exception& e) {
+                Opm::OpmLog::error(fmt::format("Asynchronous output failed: {}", e.what()));
+            }
+            catch (...) {
+                Opm::OpmLog::error("Asynchronous output failed with an unknown error");
+            }
+        }
+    }
+
+    void push(std::function<void()> job)
+    {
+        std::unique_lock<std::mutex> lock { this->mutex_ };
+        this->slot_available_.wait(lock, [this]()
+        {
+            return (this->jobs_.size() < this->max_pending_)
+                || this->error_;
+        });
+
+        this->rethrowError();
+
+        this->jobs_.push_back(std::move(job));
+        lock.unlock();
+
+        this->job_available_.notify_one();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock { this->mutex_ };
+        this->idle_.wait(lock, [this]()
+        {
+            return this->jobs_.empty() && !this->busy_;
+        });
+
+        this->rethrowError();
+    }
+
+private:
+    std::size_t max_pending_;
+    std::deque<std::function<void()>> jobs_{};
+    bool busy_{false};
+    bool stop_{false};
+    std::exception_ptr error_{};
+
+    std::mutex mutex_{};
+    std::condition_variable job_available_{};
+    std::condition_variable slot_available_{};
+    std::condition_variable idle_{};
+
+    // Must be initialised last since the thread starts using the other
+    // members immediately.
+    std::thread worker_;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock { this->mutex_ };
+
+        while (true) {
+            this->job_available_.wait(lock, [this]()
+            {
+                return this->stop_ || !this->jobs_.empty();
+            });
+
+            if (this->jobs_.empty()) {
+                // Stop requested and all pending output written.
+                return;
+            }
+
+            auto job = std::move(this->jobs_.front());
+            this->jobs_.pop_front();
+            this->busy_ = true;
+            lock.unlock();
+
+            this->slot_available_.notify_one();
+
+            std::exception_ptr error{};
+            try {
+                job();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            this->busy_ = false;
+
+            if (error && !this->error_) {
+                this->error_ = error;
+                this->jobs_.clear();
+                this->slot_available_.notify_all();
+            }
+
+            if (this->jobs_.empty()) {
+                this->idle_.notify_all();
+            }
+        }
+    }
+
+    // Caller must hold the mutex.
+    void rethrowError()
+    {
+        if (this->error_) {
+            auto error = std::exchange(this->error_, nullptr);
+            std::rethrow_exception(error);
+        }
+    }
+};
+
 } // Anonymous namespace
 
 class Opm::EclipseIO::Impl
@@ -105,7 +259,8 @@ public:
          const Schedule&,
          const SummaryConfig&,
          const std::string& baseName,
-         const bool writeEsmry);
+         const bool writeEsmry,
+         const bool writeCsmry);
 
     void writeINITFile(const data::Solution&                   simProps,
                        std::map<std::string, std::vector<int>> int_data,
@@ -121,6 +276,32 @@ public:
 
     void recordSummaryOutput(const double secs_elapsed);
 
+    /// Files to write for a single call to writeTimeStep().  Decided on
+    /// the calling thread since the SUMTHIN bookkeeping is stateful.
+    struct TimeStepOutput
+    {
+        int report_step{};
+        int report_index{};
+        int ministep_id{};
+        double secs_elapsed{};
+        bool write_double{false};
+
+        bool summary{false};
+        bool summary_substep{false};
+        bool final_summary{false};
+        bool run_summary{false};
+        bool restart{false};
+        bool rft{false};
+        bool existing_rft{false};
+    };
+
+    void writeTimeStepFiles(const TimeStepOutput& output,
+                            const Action::State&  action_state,
+                            const WellTestState&  wtest_state,
+                            const SummaryState&   st,
+                            const UDQState&       udq_state,
+                            RestartValue          value);
+
     const EclipseState& es;
     EclipseGrid grid;
 
@@ -133,6 +314,12 @@ public:
 
     std::optional<RestartIO::Helpers::AggregateAquiferData> aquiferData{std::nullopt};
 
+    /// Background writer.  Null in synchronous output mode.  Reset before
+    /// any other member is destroyed so that pending output is flushed.
+    std::unique_ptr<OutputQueue> outputQueue{};
+
+    ~Impl() { this->outputQueue.reset(); }
+
 private:
     mutable bool sumthin_active_{false};
     mutable bool sumthin_triggered_{false};
@@ -148,14 +335,15 @@ Opm::EclipseIO::Impl::Impl(const EclipseState& eclipseState,
                            const Schedule&      schedule_,
                            const SummaryConfig& summary_config,
                            const std::string&   base_name,
-                           const bool           writeEsmry)
+                           const bool           writeEsmry,
+                           const bool           writeCsmry)
     : es            (eclipseState)
     , grid          (std::move(grid_))
     , schedule      (schedule_)
     , outputDir     (eclipseState.getIOConfig().getOutputDir())
     , baseName      (uppercase(eclipseState.getIOConfig().getBaseName()))
     , summaryConfig (summary_config)
-    , summary       (summaryConfig, eclipseState, grid, schedule, base_name, writeEsmry)
+    , summary       (summaryConfig, eclipseState, grid, schedule, base_name, writeEsmry, writeCsmry)
     , output_enabled(eclipseState.getIOConfig().getOutputEnabled())
 {
     if (const auto& aqConfig = this->es.aquifer();
@@ -248,6 +436,62 @@ bool Opm::EclipseIO::Impl::summaryAtRptOnly(const int report_step) const
     return this->schedule[report_step - 1].rptonly();
 }
 
+void Opm::EclipseIO::Impl::writeTimeStepFiles(const TimeStepOutput& output,
+                                              const Action::State&  action_state,
+                                              const WellTestState&  wtest_state,
+                                              const SummaryState&   st,
+                                              const UDQState&       udq_state,
+                                              RestartValue          value)
+{
+    const auto& ioConfig = this->es.cfg().io();
+
+    if (output.summary) {
+        this->summary.add_timestep(st, output.report_index,
+                                   output.ministep_id, output.summary_substep);
+        this->summary.write(output.final_summary);
+    }
+
+    if (output.run_summary) {
+        std::filesystem::path outputDir { this->outputDir } ;
+        std::filesystem::path outputFile { outputDir / this->baseName } ;
+        EclIO::ESmry(outputFile.generic_string()).write_rsm_file();
+    }
+
+    if (output.restart) {
+        EclIO::OutputStream::Restart rstFile {
+            EclIO::OutputStream::ResultSet { this->outputDir, this->baseName },
+            output.report_index,
+            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
+            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
+        };
+
+        // The RFT output below needs the well results, so only hand a
+        // copy to the restart writer in that case.
+        auto restart_value = output.rft ? value : std::move(value);
+
+        RestartIO::save(rstFile, output.report_step, output.secs_elapsed,
+                        std::move(restart_value), this->es, this->grid,
+                        this->schedule, action_state, wtest_state, st,
+                        udq_state, this->aquiferData, output.write_double);
+    }
+
+    if (output.rft) {
+        // Open existing RFT file if report step is after first RFT event.
+        const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
+            output.existing_rft
+        };
+
+        EclIO::OutputStream::RFT rftFile {
+            EclIO::OutputStream::ResultSet { this->outputDir, this->baseName },
+            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
+            openExisting
+        };
+
+        RftIO::write(output.report_step, output.secs_elapsed, this->es.getUnits(),
+                     this->grid, this->schedule, value.wells, rftFile);
+    }
+}
+
 // ---------------------------------------------------------------------------
 
 Opm::EclipseIO::EclipseIO(const EclipseState&  es,
@@ -255,10 +499,11 @@ Opm::EclipseIO::EclipseIO(const EclipseState&  es,
                           const Schedule&      schedule,
                           const SummaryConfig& summary_config,
                           const std::string&   baseName,
-                          const bool           writeEsmry)
+                          const bool           writeEsmry,
+                          const bool           writeCsmry)
     : impl { std::make_unique<Impl>(es, std::move(grid),
                                     schedule, summary_config,
-                                    baseName, writeEsmry) }
+                                    baseName, writeEsmry, writeCsmry) }
 {
     if (! this->impl->output_enabled) {
         return;
@@ -310,63 +555,53 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
         return;
     }
 
-    const auto& es = this->impl->es;
-    const auto& grid = this->impl->grid;
     const auto& schedule = this->impl->schedule;
-    const auto& ioConfig = es.cfg().io();
 
     const bool final_step { report_step == static_cast<int>(schedule.size()) - 1 };
-    const bool is_final_summary = final_step && !isSubstep;
+
+    Impl::TimeStepOutput output{};
+    output.report_step = report_step;
+    output.secs_elapsed = secs_elapsed;
+    output.write_double = write_double;
 
     // If --enable-write-all-solutions=true we will output every timestep
-    int report_index = time_step ? (*time_step+1) : report_step;
+    output.report_index = time_step ? (*time_step+1) : report_step;
     if (((report_step > 0) &&
         this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed)) || time_step)
     {
-        this->impl->summary.add_timestep(st, report_index, !time_step || isSubstep);
-        this->impl->summary.write(is_final_summary);
+        output.summary = true;
+        output.ministep_id = this->impl->summary.miniStepId();
+        output.summary_substep = !time_step || isSubstep;
+        output.final_summary = final_step && !isSubstep;
         this->impl->recordSummaryOutput(secs_elapsed);
     }
 
-    if (final_step && !isSubstep && this->impl->summaryConfig.createRunSummary()) {
-        std::filesystem::path outputDir { this->impl->outputDir } ;
-        std::filesystem::path outputFile { outputDir / this->impl->baseName } ;
-        EclIO::ESmry(outputFile.generic_string()).write_rsm_file();
-    }
-
-    if ( (time_step && *time_step > 0 ) || (!isSubstep && schedule.write_rst_file(report_step))) {
-        EclIO::OutputStream::Restart rstFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            report_index,
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
-        };
+    output.run_summary = final_step && !isSubstep
+        && this->impl->summaryConfig.createRunSummary();
 
-        RestartIO::save(rstFile, report_step, secs_elapsed, value,
-                        es, grid, schedule, action_state, wtest_state, st,
-                        udq_state, this->impl->aquiferData, write_double);
-    }
+    output.restart = (time_step && *time_step > 0)
+        || (!isSubstep && schedule.write_rst_file(report_step));
 
     // RFT file written only if requested and never for substeps.
-    if (const auto& [wantRFT, haveExistingRFT] =
+    std::tie(output.rft, output.existing_rft) =
         this->impl->wantRFTOutput(report_step, isSubstep);
-        wantRFT)
-    {
-        // Open existing RFT file if report step is after first RFT event.
-        const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
-            haveExistingRFT
-        };
 
-        EclIO::OutputStream::RFT rftFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            openExisting
-        };
-
-        RftIO::write(report_step, secs_elapsed, es.getUnits(),
-                     grid, schedule, value.wells, rftFile);
+    if (this->impl->outputQueue == nullptr) {
+        this->impl->writeTimeStepFiles(output, action_state, wtest_state,
+                                       st, udq_state, std::move(value));
+    }
+    else if (output.summary || output.run_summary || output.restart || output.rft) {
+        // Snapshot the dynamic state since the simulator continues to
+        // update its own objects while the writer is working.
+        this->impl->outputQueue->push(
+            [impl = this->impl.get(), output,
+             action_state = action_state, wtest_state = wtest_state,
+             st = st, udq_state = udq_state,
+             value = std::move(value)]() mutable
+        {
+            impl->writeTimeStepFiles(output, action_state, wtest_state,
+                                     st, udq_state, std::move(value));
+        });
     }
 
     if (!isSubstep) {
@@ -375,7 +610,7 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
             const auto& unit_system = this->impl->es.getUnits();
 
             RptIO::write_report(ss, report.first, report.second,
-                                schedule, grid, unit_system, report_step);
+                                schedule, this->impl->grid, unit_system, report_step);
 
             auto log_string = ss.str();
             if (!log_string.empty()) {
@@ -385,6 +620,33 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
     }
 }
 
+void Opm::EclipseIO::enableAsyncOutput(const std::size_t max_pending)
+{
+    if (max_pending == 0) {
+        throw std::invalid_argument {
+            "Asynchronous output queue must allow at least one pending time step"
+        };
+    }
+
+    if (! this->impl->output_enabled || (this->impl->outputQueue != nullptr)) {
+        return;
+    }
+
+    // The writer thread's RFT output and the PRT reports query the geometry
+    // of every active cell, so store it once instead of computing it cell
+    // by cell on every report step.
+    this->impl->grid.computeActiveGeometry();
+
+    this->impl->outputQueue = std::make_unique<OutputQueue>(max_pending);
+}
+
+void Opm::EclipseIO::waitForOutput()
+{
+    if (this->impl->outputQueue != nullptr) {
+        this->impl->outputQueue->wait();
+    }
+}
+
 Opm::RestartValue
 Opm::EclipseIO::loadRestart(Action::State&                 action_state,
                             SummaryState&                  summary_state,
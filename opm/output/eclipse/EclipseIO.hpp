@@ -27,6 +27,7 @@
 #include <opm/output/data/Solution.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
@@ -67,7 +68,8 @@ public:
               const Schedule&      schedule,
               const SummaryConfig& summary_config,
               const std::string&   basename = "",
-              const bool writeEsmry = false);
+              const bool writeEsmry = false,
+              const bool writeCsmry = false);
 
     EclipseIO(const EclipseIO&) = delete;
 
@@ -151,6 +153,41 @@ public:
                        const bool write_double = false,
                        std::optional<int>   time_step = std::nullopt);
 
+    /// \brief Switch time step output to a dedicated writer thread.
+    ///
+    /// Once enabled, writeTimeStep() decides which files to write, takes a
+    /// snapshot of the dynamic state objects and the RestartValue, and
+    /// hands the conversion and file I/O to a background writer.  The
+    /// simulator thread only blocks if there are already max_pending time
+    /// steps waiting to be written.  Errors raised by the writer are
+    /// rethrown from the next call to writeTimeStep() or waitForOutput().
+    /// Errors still pending when the EclipseIO object is destroyed are
+    /// only logged with OpmLog::error(), so call waitForOutput() at the end
+    /// of the simulation.
+    ///
+    /// The writer reads the Schedule and EclipseState passed to the
+    /// constructor while output is pending; they are not copied.  The
+    /// caller must therefore call waitForOutput() before modifying either
+    /// of them, e.g. before Schedule::applyAction() for an ACTIONX which
+    /// triggered, before Schedule::applyKeywords() from Python, and before
+    /// applying schedule keywords to the field properties.
+    ///
+    /// The MINISTEP number is taken from summary() on the calling thread,
+    /// and summary().eval() may run while output is pending.  The writer
+    /// owns the summary file streams, so summary().write() must not be
+    /// called until waitForOutput() returns.  Calling this function more
+    /// than once is a no-op.
+    ///
+    /// \param[in] max_pending Maximum number of time steps queued for
+    ///    output.  Must be positive.
+    void enableAsyncOutput(std::size_t max_pending = 1);
+
+    /// \brief Block until all queued time step output has been written.
+    ///
+    /// Use this before checkpointing or inspecting the result files.
+    /// Returns immediately in synchronous output mode.
+    void waitForOutput();
+
     /// Will load solution data and wellstate from the restart file.  This
     /// method will consult the IOConfig object to get filename and report
     /// step to restart from.
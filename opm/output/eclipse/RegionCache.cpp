@@ -31,7 +31,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <map>
+#include <numeric>
 #include <set>
 #include <string>
 #include <vector>
@@ -61,15 +63,43 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
                        return std::cref(fp.get_int(fipReg));
                    });
 
+    for (const auto& wname : schedule.back().well_order()) {
+        if (! schedule.back().wells(wname).getConnections().empty()) {
+            this->well_names.push_back(wname);
+        }
+    }
+
+    std::sort(this->well_names.begin(), this->well_names.end());
+
+    // Connections of each region set in discovery order, for the
+    // compressed tables.
+    struct TableEntry
+    {
+        int region;
+        std::size_t well;
+        std::size_t cell;
+        std::size_t conn;
+    };
+
+    auto entries = std::vector<std::vector<TableEntry>>(fip_regions.size());
+
     for (const auto& wname : schedule.back().well_order()) {
         const auto& conns = schedule.back().wells(wname).getConnections();
         if (conns.empty()) { continue; }
 
+        const auto wellIx = static_cast<std::size_t>
+            (std::distance(this->well_names.begin(),
+                           std::lower_bound(this->well_names.begin(),
+                                            this->well_names.end(), wname)));
+
         auto regID = regions.begin();
+        auto regEntries = entries.begin();
         for (const auto& fipReg : fip_regions) {
             auto first = true;
 
-            for (const auto& conn : conns) {
+            for (auto connIx = 0*conns.size(); connIx < conns.size(); ++connIx) {
+                const auto& conn = conns[connIx];
+
                 if (! grid.cellActive(conn.global_index())) {
                     continue;
                 }
@@ -80,6 +110,8 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
                 this->connection_map[reg_pair]
                     .emplace_back(wname, conn.global_index());
 
+                regEntries->push_back({ region, wellIx, conn.global_index(), connIx });
+
                 if (first) {
                     this->well_map[reg_pair].push_back(wname);
 
@@ -88,8 +120,49 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
             }
 
             ++regID;
+            ++regEntries;
         }
     }
+
+    auto regEntries = entries.begin();
+    for (const auto& fipReg : fip_regions) {
+        auto& table = this->connection_tables[fipReg];
+
+        auto maxRegion = -1;
+        for (const auto& entry : *regEntries) {
+            maxRegion = std::max(maxRegion, entry.region);
+        }
+
+        // Counting sort by region, preserving the discovery order within
+        // each region.
+        table.start.assign(maxRegion + 2, 0);
+        for (const auto& entry : *regEntries) {
+            if (entry.region >= 0) {
+                ++table.start[entry.region + 1];
+            }
+        }
+
+        std::partial_sum(table.start.begin(), table.start.end(), table.start.begin());
+
+        const auto numConn = table.start.back();
+        table.well.resize(numConn);
+        table.cell.resize(numConn);
+        table.conn.resize(numConn);
+
+        auto next = std::vector<std::size_t>(table.start.begin(), table.start.end() - 1);
+        for (const auto& entry : *regEntries) {
+            if (entry.region < 0) {
+                continue;
+            }
+
+            const auto i = next[entry.region]++;
+            table.well[i] = entry.well;
+            table.cell[i] = entry.cell;
+            table.conn[i] = entry.conn;
+        }
+
+        ++regEntries;
+    }
 }
 
 
@@ -116,3 +189,19 @@ Opm::out::RegionCache::wells(const std::string& region_name,
         ? std::vector<std::string> {}
         : iter->second;
 }
+
+const std::vector<std::string>&
+Opm::out::RegionCache::wellNames() const
+{
+    return this->well_names;
+}
+
+const Opm::out::RegionCache::ConnectionTable*
+Opm::out::RegionCache::connectionTable(const std::string& region_name) const
+{
+    auto iter = this->connection_tables.find(region_name);
+
+    return (iter == this->connection_tables.end())
+        ? nullptr
+        : &iter->second;
+}
@@ -52,6 +52,31 @@ namespace Opm { namespace out {
         // A well is assigned to the region_id of its first connection.
         std::vector<std::string> wells(const std::string& region_name, int region_id) const;
 
+        // Connections of all non-negative region IDs of one region set in
+        // compressed sparse row form.  The connections of region r are
+        // elements [start[r], start[r + 1]) of the per connection arrays,
+        // in the same order as connections(region_name, r).  Regions
+        // beyond start.size() - 2 have no connections.
+        struct ConnectionTable
+        {
+            std::vector<std::size_t> start{};
+
+            // Index into wellNames().
+            std::vector<std::size_t> well{};
+
+            // Global cell index.
+            std::vector<std::size_t> cell{};
+
+            // Position of the connection in the well's connection list.
+            std::vector<std::size_t> conn{};
+        };
+
+        // Names of all wells with connections, sorted alphabetically.
+        const std::vector<std::string>& wellNames() const;
+
+        // Nullptr if region_name is not a region set of the cache.
+        const ConnectionTable* connectionTable(const std::string& region_name) const;
+
     private:
         using RegID = std::pair<std::string, int>;            // { Region set, region ID }
         using WellConn = std::pair<std::string, std::size_t>; // { Well name, cell ID }
@@ -59,6 +84,9 @@ namespace Opm { namespace out {
         std::vector<WellConn> connections_empty{};
         std::map<RegID, std::vector<WellConn>> connection_map{};
         std::map<RegID, std::vector<std::string>> well_map{};
+
+        std::vector<std::string> well_names{};
+        std::map<std::string, ConnectionTable> connection_tables{};
     };
 }} // namespace Opm::out
 
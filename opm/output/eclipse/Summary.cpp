@@ -55,6 +55,7 @@
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
 
+#include <opm/io/eclipse/ColSmryOutput.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/OutputStream.hpp>
@@ -74,6 +75,7 @@
 #include <cctype>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <exception>
 #include <filesystem>
@@ -81,11 +83,14 @@
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <map>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -542,6 +547,40 @@ struct quantity {
 };
 
 
+struct fn_args;
+
+/*
+ * Region level connection rates.  The rates of all regions of a region set
+ * are accumulated in a single pass over the region set's connections and
+ * shared by all region rate vectors of one summary evaluation.  Region
+ * vectors are evaluated serially, so there is no locking.
+ */
+class RegionRateAccumulator
+{
+public:
+    // Connection rates, times efficiency factors, summed per region ID.
+    // Rates flowing in the opposite direction are clamped to zero.
+    const std::vector<double>&
+    rates(const fn_args&     args,
+          const std::string& region_set,
+          rt                 phase,
+          bool               injection);
+
+private:
+    // Efficiency factor and simulator results of each element of
+    // RegionCache::wellNames().
+    struct WellData
+    {
+        std::vector<double> factor{};
+        std::vector<const Opm::data::Well*> results{};
+    };
+
+    std::optional<WellData> wells_{};
+    std::map<std::tuple<std::string, rt, bool>, std::vector<double>> sums_{};
+
+    const WellData& wellData(const fn_args& args);
+};
+
 /*
  * All functions must have the same parameters, so they're gathered in a struct
  * and functions use whatever information they care about.
@@ -552,20 +591,21 @@ struct quantity {
 struct fn_args
 {
     const std::vector<const Opm::Well*>& schedule_wells;
-    const std::string group_name;
-    const std::string keyword_name;
+    const std::string& group_name;
+    const std::string& keyword_name;
     double duration;
     const int sim_step;
     int  num;
-    const std::optional<std::variant<std::string, int>> extra_data;
+    const std::optional<std::variant<std::string, int>>& extra_data;
     const Opm::SummaryState& st;
     const Opm::data::Wells& wells;
     const Opm::data::WellBlockAveragePressures& wbp;
     const Opm::data::GroupAndNetworkValues& grp_nwrk;
     const Opm::out::RegionCache& regionCache;
+    RegionRateAccumulator& region_rates;
     const Opm::EclipseGrid& grid;
     const Opm::Schedule& schedule;
-    const std::vector< std::pair< std::string, double > > eff_factors;
+    const std::vector< std::pair< std::string, double > >& eff_factors;
     const Opm::Inplace& initial_inplace;
     const Opm::Inplace& inplace;
     const Opm::UnitSystem& unit_system;
@@ -656,15 +696,16 @@ template <>
     return measure::rate;
 }
 
+// The efficiency factors are sorted by well name.
 double efac( const std::vector<std::pair<std::string,double>>& eff_factors, const std::string& name)
 {
-    auto it = std::find_if(eff_factors.begin(), eff_factors.end(),
-        [&name](const std::pair<std::string, double>& elem)
+    auto it = std::lower_bound(eff_factors.begin(), eff_factors.end(), name,
+        [](const std::pair<std::string, double>& elem, const std::string& key)
     {
-        return elem.first == name;
+        return elem.first < key;
     });
 
-    return (it != eff_factors.end()) ? it->second : 1.0;
+    return ((it != eff_factors.end()) && (it->first == name)) ? it->second : 1.0;
 }
 
 inline bool
@@ -1717,23 +1758,11 @@ inline quantity duration( const fn_args& args ) {
 
 template<rt phase , bool injection>
 quantity region_rate( const fn_args& args ) {
-    double sum = 0;
-    const auto& well_connections = args.regionCache.connections( std::get<std::string>(*args.extra_data), args.num );
-
-    for (const auto& pair : well_connections) {
-
-        double eff_fac = efac( args.eff_factors, pair.first );
+    const auto& sums = args.region_rates
+        .rates(args, std::get<std::string>(*args.extra_data), phase, injection);
 
-        double Rate = args.wells.get( pair.first , pair.second , phase ) * eff_fac;
-
-        // We are asking for the production rate in an injector - or
-        // opposite. We just clamp to zero.
-        if ((Rate > 0) != injection) {
-            Rate = 0;
-        }
-
-        sum += Rate;
-    }
+    const double sum = ((args.num >= 0) && (static_cast<std::size_t>(args.num) < sums.size()))
+        ? sums[args.num] : 0.0;
 
     if( injection )
         return { sum, rate_unit< phase >() };
@@ -3266,39 +3295,39 @@ bool need_wells(const Opm::EclIO::SummaryNode& node)
     };
 }
 
-void updateValue(const Opm::EclIO::SummaryNode& node, const double value, Opm::SummaryState& st)
+Opm::SummaryState::slot_type
+valueSlot(const Opm::EclIO::SummaryNode& node, Opm::SummaryState& st)
 {
     using Cat = Opm::EclIO::SummaryNode::Category;
 
     switch (node.category) {
     case Cat::Well:
-        st.update_well_var(node.wgname, node.keyword, value);
-        break;
+        return st.well_var_slot(node.wgname, node.keyword);
 
     case Cat::Group:
     case Cat::Node:
-        st.update_group_var(node.wgname, node.keyword, value);
-        break;
+        return st.group_var_slot(node.wgname, node.keyword);
 
     case Cat::Connection:
-        st.update_conn_var(node.wgname, node.keyword, node.number, value);
-        break;
+        return st.conn_var_slot(node.wgname, node.keyword, node.number);
 
     case Cat::Segment:
-        st.update_segment_var(node.wgname, node.keyword, node.number, value);
-        break;
+        return st.segment_var_slot(node.wgname, node.keyword, node.number);
 
     case Cat::Region:
-        st.update_region_var(node.fip_region.value_or("FIPNUM"),
-                             node.keyword, node.number, value);
-        break;
+        return st.region_var_slot(node.fip_region.value_or("FIPNUM"),
+                                  node.keyword, node.number);
 
     default:
-        st.update(node.unique_key(), value);
-        break;
+        return st.intern(node.unique_key());
     }
 }
 
+void updateValue(const Opm::EclIO::SummaryNode& node, const double value, Opm::SummaryState& st)
+{
+    st.update_slot(valueSlot(node, st), value);
+}
+
 /*
  * The well efficiency factor will not impact the well rate itself, but is
  * rather applied for accumulated values.The WEFAC can be considered to shut
@@ -3320,22 +3349,36 @@ struct EfficiencyFactor
     using Factor  = std::pair<std::string, double>;
     using FacColl = std::vector<Factor>;
 
+    // Sorted by well name.
     FacColl factors{};
 
+    // Well efficiency factor and the efficiency factors of the well's
+    // groups, for each element of 'factors'.  Group factors of element i
+    // are group_factors[group_start[i] .. group_start[i + 1]).  Fixed for a
+    // report step.
+    std::vector<double> well_factors{};
+    std::vector<double> group_factors{};
+    std::vector<std::size_t> group_start{};
+
     void setFactors(const Opm::EclIO::SummaryNode&       node,
                     const Opm::Schedule&                 schedule,
                     const std::vector<const Opm::Well*>& schedule_wells,
-                    const int                            sim_step,
-                    const Opm::data::Wells&              sim_res);
+                    const int                            sim_step);
+
+    // Apply the simulator's dynamic efficiency scaling to the static
+    // factors.
+    void applyScaling(const Opm::data::Wells& sim_res);
 };
 
 void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
                                   const Opm::Schedule&                 schedule,
                                   const std::vector<const Opm::Well*>& schedule_wells,
-                                  const int                            sim_step,
-                                  const Opm::data::Wells&              sim_res)
+                                  const int                            sim_step)
 {
     this->factors.clear();
+    this->well_factors.clear();
+    this->group_factors.clear();
+    this->group_start.assign(1, 0);
 
     const bool is_field  { node.category == Opm::EclIO::SummaryNode::Category::Field  } ;
     const bool is_group  { node.category == Opm::EclIO::SummaryNode::Category::Group  } ;
@@ -3345,24 +3388,30 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
     if (!is_field && !is_group && !is_region && is_rate)
         return;
 
+    struct Chain
+    {
+        std::string well;
+        double well_factor;
+        std::vector<double> group_factors;
+    };
+
+    auto chains = std::vector<Chain>{};
+
     for (const auto* well : schedule_wells) {
         if (!well->hasBeenDefined(sim_step))
             continue;
 
-        const auto res_it = sim_res.find(well->name());
-        double efficiency_scaling_factor = 1.0;
-        if (res_it != sim_res.end()) {
-            efficiency_scaling_factor = res_it->second.efficiency_scaling_factor;
-        }
+        auto& chain = chains.emplace_back();
+        chain.well = well->name();
+        chain.well_factor = well->getEfficiencyFactor();
 
-        double eff_factor = well->getEfficiencyFactor() * efficiency_scaling_factor;
         const auto* group_ptr = std::addressof(schedule.getGroup(well->groupName(), sim_step));
 
         while (group_ptr) {
             if (is_group && is_rate && (group_ptr->name() == node.wgname))
                 break;
 
-            eff_factor *= group_ptr->getGroupEfficiencyFactor();
+            chain.group_factors.push_back(group_ptr->getGroupEfficiencyFactor());
 
             const auto parent_group = group_ptr->flow_group();
 
@@ -3371,11 +3420,139 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
             else
                 group_ptr = nullptr;
         }
+    }
+
+    std::stable_sort(chains.begin(), chains.end(),
+                     [](const Chain& c1, const Chain& c2)
+                     {
+                         return c1.well < c2.well;
+                     });
 
-        this->factors.emplace_back(well->name(), eff_factor);
+    for (auto& chain : chains) {
+        this->factors.emplace_back(std::move(chain.well), 1.0);
+        this->well_factors.push_back(chain.well_factor);
+        this->group_factors.insert(this->group_factors.end(),
+                                   chain.group_factors.begin(),
+                                   chain.group_factors.end());
+        this->group_start.push_back(this->group_factors.size());
     }
 }
 
+void EfficiencyFactor::applyScaling(const Opm::data::Wells& sim_res)
+{
+    for (auto i = 0*this->factors.size(); i < this->factors.size(); ++i) {
+        auto& [name, factor] = this->factors[i];
+
+        const auto res_it = sim_res.find(name);
+        const auto efficiency_scaling_factor = (res_it != sim_res.end())
+            ? res_it->second.efficiency_scaling_factor : 1.0;
+
+        // Same order of multiplication as the well to top group walk.
+        factor = this->well_factors[i] * efficiency_scaling_factor;
+        for (auto g = this->group_start[i]; g < this->group_start[i + 1]; ++g) {
+            factor *= this->group_factors[g];
+        }
+    }
+}
+
+const RegionRateAccumulator::WellData&
+RegionRateAccumulator::wellData(const fn_args& args)
+{
+    if (this->wells_.has_value()) {
+        return *this->wells_;
+    }
+
+    const auto& names = args.regionCache.wellNames();
+
+    auto schedule_wells = std::vector<const Opm::Well*>{};
+    for (const auto& name : names) {
+        if (args.schedule.hasWell(name, args.sim_step)) {
+            schedule_wells.push_back(&args.schedule.getWell(name, args.sim_step));
+        }
+    }
+
+    // Region level factors do not depend on the particular region.
+    auto node = Opm::EclIO::SummaryNode{};
+    node.category = Opm::EclIO::SummaryNode::Category::Region;
+
+    auto eFac = EfficiencyFactor{};
+    eFac.setFactors(node, args.schedule, schedule_wells, args.sim_step);
+    eFac.applyScaling(args.wells);
+
+    auto& wells = this->wells_.emplace();
+    wells.factor.reserve(names.size());
+    wells.results.reserve(names.size());
+
+    for (const auto& name : names) {
+        wells.factor.push_back(efac(eFac.factors, name));
+
+        const auto xwPos = args.wells.find(name);
+        wells.results.push_back((xwPos == args.wells.end())
+                                ? nullptr : &xwPos->second);
+    }
+
+    return wells;
+}
+
+const std::vector<double>&
+RegionRateAccumulator::rates(const fn_args&     args,
+                             const std::string& region_set,
+                             const rt           phase,
+                             const bool         injection)
+{
+    auto [pos, inserted] = this->sums_
+        .try_emplace(std::make_tuple(region_set, phase, injection));
+
+    auto& sums = pos->second;
+    if (! inserted) {
+        return sums;
+    }
+
+    const auto* table = args.regionCache.connectionTable(region_set);
+    if ((table == nullptr) || (table->start.size() < 2)) {
+        return sums;
+    }
+
+    const auto& wells = this->wellData(args);
+
+    sums.assign(table->start.size() - 1, 0.0);
+    for (auto region = 0*sums.size(); region < sums.size(); ++region) {
+        double sum = 0;
+
+        for (auto i = table->start[region]; i < table->start[region + 1]; ++i) {
+            const auto* xw = wells.results[table->well[i]];
+            if (xw == nullptr) {
+                continue;
+            }
+
+            // The connection's position in the schedule is a hint only.
+            const auto cell = table->cell[i];
+            const auto* xc = ((table->conn[i] < xw->connections.size()) &&
+                              (xw->connections[table->conn[i]].index == cell))
+                ? &xw->connections[table->conn[i]]
+                : xw->find_connection(cell);
+
+            if (xc == nullptr) {
+                continue;
+            }
+
+            double Rate = xc->rates.get(phase, 0.0) * wells.factor[table->well[i]];
+
+            // We are asking for the production rate in an injector - or
+            // opposite. We just clamp to zero.
+            if ((Rate > 0) != injection) {
+                Rate = 0;
+            }
+
+            sum += Rate;
+        }
+
+        sums[region] = sum;
+    }
+
+    return sums;
+}
+
 namespace Evaluator {
     struct InputData
     {
@@ -3397,6 +3574,7 @@ namespace Evaluator {
         const std::map<std::pair<std::string, int>, double>& block;
         const Opm::data::Aquifers& aquifers;
         const std::unordered_map<std::string, Opm::data::InterRegFlowMap>& ireg;
+        RegionRateAccumulator& regionRates;
     };
 
     class Base
@@ -3411,7 +3589,54 @@ namespace Evaluator {
                             Opm::SummaryState&      st) const = 0;
     };
 
-    class FunctionRelation : public Base
+    /// Evaluator producing a single value which is stored with
+    /// updateValue().  Computing the value never modifies the SummaryState,
+    /// so evaluators which do not read other summary vectors either can be
+    /// computed concurrently and their values stored afterwards.
+    class ValueBase : public Base
+    {
+    public:
+        void update(const std::size_t       sim_step,
+                    const double            stepSize,
+                    const InputData&        input,
+                    const SimulatorResults& simRes,
+                    Opm::SummaryState&      st) const final
+        {
+            const auto val = this->value(sim_step, stepSize, input, simRes, st);
+            if (val.has_value()) {
+                this->store(*val, st);
+            }
+        }
+
+        /// Value to store, or nullopt if no value is available for the
+        /// current step.
+        virtual std::optional<double>
+        value(const std::size_t        sim_step,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& st) const = 0;
+
+        void store(const double val, Opm::SummaryState& st) const
+        {
+            updateValue(this->node(), val, st);
+        }
+
+        /// SummaryState slot of the stored value.  Storing a value in the
+        /// slot is equivalent to store().
+        Opm::SummaryState::slot_type slot(Opm::SummaryState& st) const
+        {
+            return valueSlot(this->node(), st);
+        }
+
+        /// Whether value() reads nothing from the SummaryState.
+        virtual bool concurrent() const { return true; }
+
+    protected:
+        virtual const Opm::EclIO::SummaryNode& node() const = 0;
+    };
+
+    class FunctionRelation : public ValueBase
     {
     public:
         explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn)
@@ -3421,30 +3646,32 @@ namespace Evaluator {
             if (this->use_number()) {
                 this->number_ = std::max(0, this->node_.number);
             }
+
+            this->group_name_ = this->group_name();
+
+            if (this->node_.fip_region.has_value()) {
+                this->extra_data_.emplace(*this->node_.fip_region);
+            }
         }
 
-        void update(const std::size_t       sim_step,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t        sim_step,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& st) const override
         {
-            const auto wells = need_wells(this->node_)
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<const Opm::Well*>{};
-
-            EfficiencyFactor eFac{};
-            eFac.setFactors(this->node_, input.sched, wells, sim_step, simRes.wellSol);
+            auto& plan = this->stepPlan(sim_step, input);
+            plan.eFac.applyScaling(simRes.wellSol);
 
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword,
+                plan.wells, this->group_name_, this->node_.keyword,
                 stepSize, static_cast<int>(sim_step),
-                this->number_, this->node_.fip_region,
+                this->number_, this->extra_data_,
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
-                input.reg, input.grid, input.sched,
-                std::move(eFac.factors),
+                input.reg, simRes.regionRates, input.grid, input.sched,
+                plan.eFac.factors,
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits()
             };
@@ -3452,13 +3679,80 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            return usys.from_si(prm.unit, prm.value);
+        }
+
+        bool concurrent() const override
+        {
+            // Some well, group and region level functions consult other
+            // summary vectors or UDAs through the SummaryState.  None of
+            // the connection and block level functions do.
+            using Cat = ::Opm::EclIO::SummaryNode::Category;
+            const auto cat = this->node_.category;
+
+            return (cat == Cat::Connection)
+                || (cat == Cat::Completion)
+                || (cat == Cat::Block);
+        }
+
+    protected:
+        const Opm::EclIO::SummaryNode& node() const override
+        {
+            return this->node_;
         }
 
     private:
+        /// Evaluation data which depends only on the report step and the
+        /// schedule's contents: the contributing wells and their static
+        /// efficiency factors.
+        struct StepPlan
+        {
+            std::size_t sim_step{};
+            std::uint64_t sched_revision{};
+            std::vector<const Opm::Well*> wells{};
+            EfficiencyFactor eFac{};
+        };
+
         Opm::EclIO::SummaryNode node_;
         ofun                    fcn_;
         int                     number_{0};
+        std::string             group_name_{};
+        std::optional<std::variant<std::string, int>> extra_data_{};
+
+        // Rebuilt when the report step or the schedule revision changes.
+        // The latter catches ACTIONX and PYACTION changes within a report
+        // step, which may replace the Well objects.  Mutating this cache
+        // from a const member is safe only because
+        // SummaryImplementation::eval() hands each evaluator to exactly one
+        // thread, and all threads only read the Schedule, the RegionCache
+        // and the other shared inputs.  Evaluators must not be shared
+        // between Summary objects that are evaluated concurrently.
+        mutable std::optional<StepPlan> plan_{};
+
+        StepPlan& stepPlan(const std::size_t sim_step,
+                           const InputData&  input) const
+        {
+            if (this->plan_.has_value() &&
+                (this->plan_->sim_step == sim_step) &&
+                (this->plan_->sched_revision == input.sched.revision()))
+            {
+                return *this->plan_;
+            }
+
+            auto& plan = this->plan_.emplace();
+            plan.sim_step = sim_step;
+            plan.sched_revision = input.sched.revision();
+
+            if (need_wells(this->node_)) {
+                plan.wells = find_wells(input.sched, this->node_,
+                                        static_cast<int>(sim_step), input.reg);
+            }
+
+            plan.eFac.setFactors(this->node_, input.sched, plan.wells,
+                                 static_cast<int>(sim_step));
+
+            return plan;
+        }
 
         std::string group_name() const
         {
@@ -3488,7 +3782,7 @@ namespace Evaluator {
         }
     };
 
-    class BlockValue : public Base
+    class BlockValue : public ValueBase
     {
     public:
         explicit BlockValue(Opm::EclIO::SummaryNode node,
@@ -3497,19 +3791,26 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t     /* sim_step */,
+              const double          /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            return usys.from_si(this->m_, xPos->second);
+        }
+
+    protected:
+        const Opm::EclIO::SummaryNode& node() const override
+        {
+            return this->node_;
         }
 
     private:
@@ -3522,7 +3823,7 @@ namespace Evaluator {
         }
     };
 
-    class AquiferValue: public Base
+    class AquiferValue: public ValueBase
     {
     public:
         explicit AquiferValue(Opm::EclIO::SummaryNode node,
@@ -3531,26 +3832,34 @@ namespace Evaluator {
         , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t     /* sim_step */,
+              const double          /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.aquifers.find(this->node_.number);
             if (xPos == simRes.aquifers.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            return usys.from_si(this->m_, xPos->second.get(this->node_.keyword));
         }
+
+    protected:
+        const Opm::EclIO::SummaryNode& node() const override
+        {
+            return this->node_;
+        }
+
     private:
         Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
     };
 
-    class RegionValue : public Base
+    class RegionValue : public ValueBase
     {
     public:
         explicit RegionValue(Opm::EclIO::SummaryNode node,
@@ -3559,34 +3868,41 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t     /* sim_step */,
+              const double          /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             if (this->node_.number < 0) {
-                return;
+                return std::nullopt;
             }
 
             auto xPos = simRes.region.find(this->node_.keyword);
             if (xPos == simRes.region.end()) {
                 // Vector (e.g., RPR) not available from simulator.
                 // Typically at time zero.
-                return;
+                return std::nullopt;
             }
 
             const auto ix = this->index();
             if (ix >= xPos->second.size()) {
                 // Region ID outside active set (e.g., the node specifies
                 // region ID 12 when max(FIPNUM) == 10)
-                return;
+                return std::nullopt;
             }
 
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
+        }
+
+    protected:
+        const Opm::EclIO::SummaryNode& node() const override
+        {
+            return this->node_;
         }
 
     private:
@@ -3599,7 +3915,7 @@ namespace Evaluator {
         }
     };
 
-    class InterRegionValue : public Base
+    class InterRegionValue : public ValueBase
     {
     public:
         explicit InterRegionValue(const Opm::EclIO::SummaryNode& node,
@@ -3613,30 +3929,37 @@ namespace Evaluator {
             this->analyzeKeyword();
         }
 
-        void update(const std::size_t    /* sim_step */,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t     /* sim_step */,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             if (this->component_ == Component::NumComponents) {
-                return;
+                return std::nullopt;
             }
 
             auto flows = simRes.ireg.find(this->regname_);
             if (flows == simRes.ireg.end()) {
-                return;
+                return std::nullopt;
             }
 
             auto flow = flows->second.getInterRegFlows(this->r1_, this->r2_);
             if (! flow.has_value()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
             const auto  val  = this->getValue(flow->first, flow->second, stepSize);
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
+        }
+
+    protected:
+        const Opm::EclIO::SummaryNode& node() const override
+        {
+            return this->node_;
         }
 
     private:
@@ -4301,13 +4624,14 @@ namespace Evaluator {
         }
 
         const auto reg = Opm::out::RegionCache{};
+        auto regionRates = RegionRateAccumulator{};
 
         const fn_args args {
             {}, "", this->node_->keyword, 0.0, 0,
             this->node_->number, this->node_->fip_region,
             this->st_,
             {}, {}, {},
-            reg, this->grid_, this->sched_,
+            reg, regionRates, this->grid_, this->sched_,
             {}, {}, {}, this->es_.getUnits()
         };
 
@@ -4546,7 +4870,8 @@ public:
                                    const EclipseGrid&  grid,
                                    const Schedule&     sched,
                                    const std::string&  basename,
-                                   const bool          writeEsmry);
+                                   const bool          writeEsmry,
+                                   const bool          writeCsmry);
 
     SummaryImplementation(const SummaryImplementation& rhs) = delete;
     SummaryImplementation(SummaryImplementation&& rhs) = default;
@@ -4567,7 +4892,8 @@ public:
               const InterRegFlowValues&              interreg_flows,
               SummaryState&                          st) const;
 
-    void internal_store(const SummaryState& st, const int report_step, bool isSubstep);
+    void internal_store(const SummaryState& st, const int report_step, const int ministep_id, bool isSubstep);
+    int miniStepId() const;
     void write(const bool is_final_summary);
 
 private:
@@ -4601,7 +4927,30 @@ private:
 
     SummaryOutputParameters                  outputParameters_{};
     std::unordered_map<std::string, EvalPtr> extra_parameters{};
+
+    // All evaluators in evaluation order, and for each the position of its
+    // value in the concurrently computed batch.  Position npos means the
+    // evaluator is run serially.
+    std::vector<const Evaluator::Base*> evalOrder_{};
+    std::vector<std::size_t> concurrentPos_{};
+    std::vector<const Evaluator::ValueBase*> concurrentEvals_{};
+
+    // Values of concurrentEvals_ at the current evaluation.  Kept between
+    // evaluations to avoid reallocating at every ministep.
+    mutable std::vector<std::optional<double>> concurrentValues_{};
+
+    // Single value evaluators in evaluation order, nullptr for others, and
+    // the slots of their values in the SummaryState key table identified
+    // by storeSlotsTable_.  Unset until the value is first stored.
+    std::vector<const Evaluator::ValueBase*> valueEvals_{};
+    mutable std::vector<std::optional<Opm::SummaryState::slot_type>> storeSlots_{};
+    mutable std::uint64_t storeSlotsTable_{0};
     std::vector<std::string> valueKeys_{};
+
+    // Slots of valueKeys_ in the SummaryState key table identified by
+    // valueSlotsTable_.  Unset for keys not yet known to that table.
+    std::vector<std::optional<Opm::SummaryState::slot_type>> valueSlots_{};
+    std::uint64_t valueSlotsTable_{0};
     std::vector<std::string> valueUnits_{};
     std::vector<MiniStep>    unwritten_{};
 
@@ -4609,6 +4958,7 @@ private:
     std::unique_ptr<Opm::EclIO::EclOutput> stream_{};
 
     std::unique_ptr<Opm::EclIO::ExtSmryOutput> esmry_;
+    std::unique_ptr<Opm::EclIO::ColSmryOutput> csmry_;
 
     void configureTimeVector(const EclipseState& es, const std::string& kw);
     void configureTimeVectors(const EclipseState& es, const SummaryConfig& sumcfg);
@@ -4626,7 +4976,9 @@ private:
                       Evaluator::Factory& evaluatorFactory,
                       SummaryConfig&      summary_config);
 
-    MiniStep& getNextMiniStep(const int report_step, bool isSubstep);
+    void configureEvaluationOrder();
+
+    MiniStep& getNextMiniStep(const int report_step, const int ministep_id, bool isSubstep);
     const MiniStep& lastUnwritten() const;
 
     void write(const MiniStep& ms);
@@ -4641,7 +4993,8 @@ SummaryImplementation(SummaryConfig&      sumcfg,
                       const EclipseGrid&  grid,
                       const Schedule&     sched,
                       const std::string&  basename,
-                      const bool          writeEsmry)
+                      const bool          writeEsmry,
+                      const bool          writeCsmry)
     : grid_          (std::cref(grid))
     , es_            (std::cref(es))
     , sched_         (std::cref(sched))
@@ -4665,6 +5018,7 @@ SummaryImplementation(SummaryConfig&      sumcfg,
                                              sched, evaluatorFactory);
 
     this->configureUDQ(es, sched, evaluatorFactory, sumcfg);
+    this->configureEvaluationOrder();
 
     this->regCache_.buildCache(sumcfg.fip_regions(),
                                es.globalFieldProps(),
@@ -4685,22 +5039,62 @@ SummaryImplementation(SummaryConfig&      sumcfg,
     if (writeEsmry && es.cfg().io().getFMTOUT()) {
         OpmLog::warning("ESMRY only supported for unformatted output. Request ignored.");
     }
+
+    if (writeCsmry) {
+        const auto csmryFileName = EclIO::OutputStream::
+            outputFileName(this->rset_, "CSMRY");
+
+        const auto ts = TimeStampUTC {
+            std::chrono::system_clock::to_time_t(TimeService::from_time_t(sched.posixStartTime()))
+        };
+
+        const auto& initcfg = es.getInitConfig();
+
+        this->csmry_ = std::make_unique<Opm::EclIO::ColSmryOutput>
+            (csmryFileName,
+             Opm::EclIO::ExtSmryOutput::make_modified_keys(this->valueKeys_, es.gridDims()),
+             this->valueUnits_,
+             std::vector<int> { ts.day(), ts.month(), ts.year(),
+                                ts.hour(), ts.minutes(), ts.seconds(), 0 },
+             initcfg.restartRequested() ? initcfg.getRestartRootName() : std::string{},
+             initcfg.restartRequested() ? initcfg.getRestartStep() : 0);
+    }
 }
 
 void Opm::out::Summary::SummaryImplementation::
-internal_store(const SummaryState& st, const int report_step, bool isSubstep)
+internal_store(const SummaryState& st, const int report_step, const int ministep_id, bool isSubstep)
 {
-    auto& ms = this->getNextMiniStep(report_step, isSubstep);
+    auto& ms = this->getNextMiniStep(report_step, ministep_id, isSubstep);
 
     const auto nParam = this->valueKeys_.size();
 
+    if ((this->valueSlotsTable_ != st.key_table_id()) ||
+        (this->valueSlots_.size() != nParam))
+    {
+        // Key table changed since last time.  Look up the slots again.
+        this->valueSlots_.resize(nParam);
+        for (auto i = decltype(nParam){0}; i < nParam; ++i) {
+            this->valueSlots_[i] = st.find_slot(this->valueKeys_[i]);
+        }
+
+        this->valueSlotsTable_ = st.key_table_id();
+    }
+
     for (auto i = decltype(nParam){0}; i < nParam; ++i) {
-        if (! st.has(this->valueKeys_[i]))
-            // Parameter not yet evaluated (e.g., well/group not
-            // yet active).  Nothing to do here.
-            continue;
+        const auto& slot = this->valueSlots_[i];
 
-        ms.params[i] = st.get(this->valueKeys_[i]);
+        if (slot.has_value()) {
+            if (! st.has_slot(*slot))
+                // Parameter not yet evaluated (e.g., well/group not
+                // yet active).  Nothing to do here.
+                continue;
+
+            ms.params[i] = st.get_slot(*slot);
+        }
+        else if (st.has(this->valueKeys_[i])) {
+            // Key never stored, but has a fallback value (UDQ).
+            ms.params[i] = st.get(this->valueKeys_[i]);
+        }
     }
 }
 
@@ -4731,20 +5125,83 @@ eval(const int                              sim_step,
         this->es_, this->sched_, this->grid_, this->regCache_, initial_inplace
     };
 
+    auto regionRates = RegionRateAccumulator{};
+
     const Evaluator::SimulatorResults simRes {
         well_solution, wbp, grp_nwrk_solution, single_values, inplace,
-        region_values, block_values, aquifer_values, interreg_flows
+        region_values, block_values, aquifer_values, interreg_flows,
+        regionRates
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    // Compute the values of all evaluators which do not depend on the
+    // SummaryState first.  Each evaluator is run by exactly one thread, so
+    // its internal caches need no locking, and the threads only read the
+    // SummaryState, the Schedule, the RegionCache and the simulator
+    // results.  Nothing writes to the SummaryState here.
+    const auto numConcurrent = this->concurrentEvals_.size();
+    auto& values = this->concurrentValues_;
+    values.assign(numConcurrent, std::nullopt);
+
+    // Failures are reported at the point where the serial evaluation
+    // would have encountered them.
+    auto firstFailed = numConcurrent;
+    auto failure = std::exception_ptr{};
+
+#pragma omp parallel for schedule(dynamic, 64) if(numConcurrent > 1024)
+    for (std::size_t i = 0; i < numConcurrent; ++i) {
+        try {
+            values[i] = this->concurrentEvals_[i]
+                ->value(sim_step, duration, input, simRes, st);
+        }
+        catch (...) {
+#pragma omp critical(summary_eval_failure)
+            if (i < firstFailed) {
+                firstFailed = i;
+                failure = std::current_exception();
+            }
+        }
     }
 
-    for (auto& [_, evalPtr] : this->extra_parameters) {
-        (void)_;
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    // Store all values, and run the remaining evaluators, in the original
+    // evaluation order.  The resulting SummaryState is identical to that of
+    // a fully serial evaluation.  Slots looked up in this loop stay valid
+    // when later keys are added, but not across a change of key table.
+    if (this->storeSlotsTable_ != st.key_table_id()) {
+        this->storeSlots_.assign(this->evalOrder_.size(), std::nullopt);
+    }
+
+    const auto npos = std::numeric_limits<std::size_t>::max();
+    for (auto e = 0*this->evalOrder_.size(); e < this->evalOrder_.size(); ++e) {
+        const auto* valueEval = this->valueEvals_[e];
+        const auto  pos       = this->concurrentPos_[e];
+
+        if (valueEval == nullptr) {
+            this->evalOrder_[e]->update(sim_step, duration, input, simRes, st);
+            continue;
+        }
+
+        if ((pos != npos) && (pos == firstFailed)) {
+            std::rethrow_exception(failure);
+        }
+
+        const auto val = (pos == npos)
+            ? valueEval->value(sim_step, duration, input, simRes, st)
+            : values[pos];
+
+        if (! val.has_value()) {
+            continue;
+        }
+
+        auto& slot = this->storeSlots_[e];
+        if (! slot.has_value()) {
+            slot = valueEval->slot(st);
+        }
+
+        st.update_slot(*slot, *val);
     }
 
+    this->storeSlotsTable_ = st.key_table_id();
+
     st.update_elapsed(duration);
 
     if (secs_elapsed > this->prevEvalTime_) {
@@ -4753,6 +5210,36 @@ eval(const int                              sim_step,
     }
 }
 
+void Opm::out::Summary::SummaryImplementation::configureEvaluationOrder()
+{
+    const auto npos = std::numeric_limits<std::size_t>::max();
+
+    auto add = [this, npos](const Evaluator::Base* evaluator)
+    {
+        const auto* valueEval = dynamic_cast<const Evaluator::ValueBase*>(evaluator);
+
+        this->evalOrder_.push_back(evaluator);
+        this->valueEvals_.push_back(valueEval);
+
+        if ((valueEval != nullptr) && valueEval->concurrent()) {
+            this->concurrentPos_.push_back(this->concurrentEvals_.size());
+            this->concurrentEvals_.push_back(valueEval);
+        }
+        else {
+            this->concurrentPos_.push_back(npos);
+        }
+    };
+
+    for (const auto& evalPtr : this->outputParameters_.getEvaluators()) {
+        add(evalPtr.get());
+    }
+
+    for (const auto& [_, evalPtr] : this->extra_parameters) {
+        (void)_;
+        add(evalPtr.get());
+    }
+}
+
 void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary)
 {
     const auto zero = std::vector<MiniStep>::size_type{0};
@@ -4782,6 +5269,16 @@ void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary
         }
     }
 
+    if (this->csmry_ != nullptr) {
+        // Buffered ministeps go out as a single chunk.  Only the last one
+        // may force a flush.
+        for (auto i = 0*this->numUnwritten_; i < this->numUnwritten_; ++i) {
+            this->csmry_->write(this->unwritten_[i].params,
+                                !this->unwritten_[i].isSubstep,
+                                is_final_summary && (i + 1 == this->numUnwritten_));
+        }
+    }
+
     // Reset "unwritten" counter to reflect the fact that we've
     // output all stored ministeps.
     this->numUnwritten_ = zero;
@@ -5106,7 +5603,7 @@ configureRequiredRestartParameters(const SummaryConfig& sumcfg,
 }
 
 Opm::out::Summary::SummaryImplementation::MiniStep&
-Opm::out::Summary::SummaryImplementation::getNextMiniStep(const int report_step, bool isSubstep)
+Opm::out::Summary::SummaryImplementation::getNextMiniStep(const int report_step, const int ministep_id, bool isSubstep)
 {
     if (this->numUnwritten_ == this->unwritten_.size()) {
         this->unwritten_.emplace_back();
@@ -5117,7 +5614,7 @@ Opm::out::Summary::SummaryImplementation::getNextMiniStep(const int report_step,
 
     auto& ms = this->unwritten_[this->numUnwritten_++];
 
-    ms.id  = this->miniStepID_ - 1;  // MINISTEP IDs start at zero.
+    ms.id  = ministep_id;
     ms.seq = report_step;
     ms.isSubstep = isSubstep;
 
@@ -5128,6 +5625,11 @@ Opm::out::Summary::SummaryImplementation::getNextMiniStep(const int report_step,
     return ms;
 }
 
+int Opm::out::Summary::SummaryImplementation::miniStepId() const
+{
+    return this->miniStepID_ - 1;  // MINISTEP IDs start at zero.
+}
+
 const Opm::out::Summary::SummaryImplementation::MiniStep&
 Opm::out::Summary::SummaryImplementation::lastUnwritten() const
 {
@@ -5177,8 +5679,10 @@ Summary::Summary(SummaryConfig&       sumcfg,
                  const EclipseGrid&   grid,
                  const Schedule&      sched,
                  const std::string&   basename,
-                 const bool           writeEsmry)
-    : pImpl_ { std::make_unique<SummaryImplementation>(sumcfg, es, grid, sched, basename, writeEsmry) }
+                 const bool           writeEsmry,
+                 const bool           writeCsmry)
+    : pImpl_ { std::make_unique<SummaryImplementation>(sumcfg, es, grid, sched, basename,
+                                                       writeEsmry, writeCsmry) }
 {}
 
 void Summary::eval(SummaryState&                          st,
@@ -5218,7 +5722,20 @@ void Summary::eval(SummaryState&                          st,
 
 void Summary::add_timestep(const SummaryState& st, const int report_step, bool isSubstep)
 {
-    this->pImpl_->internal_store(st, report_step, isSubstep);
+    this->add_timestep(st, report_step, this->miniStepId(), isSubstep);
+}
+
+void Summary::add_timestep(const SummaryState& st,
+                           const int           report_step,
+                           const int           ministep_id,
+                           bool                isSubstep)
+{
+    this->pImpl_->internal_store(st, report_step, ministep_id, isSubstep);
+}
+
+int Summary::miniStepId() const
+{
+    return this->pImpl_->miniStepId();
 }
 
 void Summary::write(const bool is_final_summary) const
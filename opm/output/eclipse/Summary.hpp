@@ -61,12 +61,24 @@ public:
             const EclipseGrid&  grid,
             const Schedule&     sched,
             const std::string&  basename = "",
-            const bool          writeEsmry = false);
+            const bool          writeEsmry = false,
+            const bool          writeCsmry = false);
 
     ~Summary();
 
     void add_timestep(const SummaryState& st, const int report_step, bool isSubstep);
 
+    /// As above, but with an explicit MINISTEP sequence number, e.g., one
+    /// captured by miniStepId() on the thread calling eval() for use on an
+    /// output thread.
+    void add_timestep(const SummaryState& st,
+                      const int           report_step,
+                      const int           ministep_id,
+                      bool                isSubstep);
+
+    /// MINISTEP sequence number of the most recent call to eval().
+    int miniStepId() const;
+
     void eval(SummaryState&                          summary_state,
               const int                              report_step,
               const double                           secs_elapsed,
@@ -115,6 +115,26 @@ BOOST_AUTO_TEST_CASE(numKeyword_twokeyword_return2) {
 }
 
 
+BOOST_AUTO_TEST_CASE(keywordIndex_updated) {
+    Deck deck;
+    Parser parser;
+    deck.addKeyword( DeckKeyword( parser.getKeyword("GRID")));
+    deck.addKeyword( DeckKeyword( parser.getKeyword("EDIT")));
+    BOOST_CHECK_EQUAL(1U , deck.count("GRID"));
+
+    deck.addKeyword( DeckKeyword( parser.getKeyword("GRID")));
+    BOOST_CHECK_EQUAL(2U , deck.count("GRID"));
+    BOOST_CHECK( deck.index("GRID") == std::vector<std::size_t>({0, 2}) );
+
+    deck.remove_keywords(0, 1);
+    BOOST_CHECK_EQUAL(1U , deck.count("GRID"));
+    BOOST_CHECK( deck.index("EDIT") == std::vector<std::size_t>({0}) );
+
+    Deck moved( std::move(deck) );
+    BOOST_CHECK_EQUAL(1U , moved.count("EDIT"));
+    BOOST_CHECK_EQUAL(1U , moved.getKeywordList("GRID").size());
+}
+
 BOOST_AUTO_TEST_CASE(size_twokeyword_return2) {
     Deck deck;
     Parser parser;
@@ -337,6 +357,29 @@ BOOST_AUTO_TEST_CASE(GetSIMultipleDim) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(PushBackBlockSIRoundTrip) {
+    Dimension dim{ 2, 1 };
+    Dimension defaultDim{ 10 };
+    DeckItem item( "HEI", double(), {dim}, {defaultDim} );
+
+    std::vector<double> values(100000, 3.0);
+    std::vector<value::status> status(values.size(), value::status::deck_value);
+    status[5] = value::status::valid_default;
+    item.push_back( std::move(values), std::move(status) );
+    item.push_back( std::vector<double>{ 4.0 }, std::vector<value::status>{ value::status::deck_value } );
+
+    BOOST_CHECK_EQUAL( 100001U, item.data_size() );
+    BOOST_CHECK_EQUAL(  7, item.getSIDouble(0) );
+    BOOST_CHECK_EQUAL( 30, item.getSIDouble(5) );
+    BOOST_CHECK_EQUAL(  9, item.getSIDouble(100000) );
+    BOOST_CHECK( item.defaultApplied(5) );
+
+    const auto& raw = item.getData<double>();
+    BOOST_CHECK_EQUAL( 3, raw[0] );
+    BOOST_CHECK_EQUAL( 3, raw[5] );
+    BOOST_CHECK_EQUAL( 4, raw[100000] );
+}
+
 BOOST_AUTO_TEST_CASE(HasValue) {
     DeckItem deckIntItem( "TEST", int() );
     BOOST_CHECK_EQUAL( false , deckIntItem.hasValue(0) );
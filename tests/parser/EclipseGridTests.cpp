@@ -3482,3 +3482,76 @@ PORO
     SPIDER with DR/DRV, DTHETA/DTHETAV, DZ/DZV and TOPS creates a spider grid)");
     });
 }
+
+BOOST_AUTO_TEST_CASE(ActiveGeometryMatchesCellCorners)
+{
+    const std::array<int, 3> dims {{ 3, 2, 2 }};
+    std::vector<double> coord;
+    for (int j = 0; j <= dims[1]; ++j) {
+        for (int i = 0; i <= dims[0]; ++i) {
+            // Every second pillar column is inclined.
+            const double x = 10.0 * i;
+            const double y = 7.0 * j;
+            const double tilt = (i % 2 == 1) ? 1.5 * (j + 1) : 0.0;
+            coord.insert(coord.end(), { x, y, 0.0, x + tilt, y - 0.25 * i, 100.0 });
+        }
+    }
+
+    std::vector<double> zcorn(8 * dims[0] * dims[1] * dims[2]);
+    for (std::size_t n = 0; n < zcorn.size(); ++n) {
+        const auto layer = n / (4 * dims[0] * dims[1]);
+        zcorn[n] = 10.0 * layer + 0.25 * (n % 5);
+    }
+
+    std::vector<int> actnum(dims[0] * dims[1] * dims[2], 1);
+    actnum[4] = 0;
+
+    Opm::EclipseGrid grid(dims, coord, zcorn, actnum.data());
+    BOOST_CHECK_EQUAL(grid.activeVolume().size(), grid.getNumActive());
+
+    auto check_cells = [&grid]()
+    {
+        for (std::size_t g = 0; g < grid.getCartesianSize(); ++g) {
+            const auto [i, j, k] = grid.getIJK(g);
+            std::array<double, 8> X, Y, Z;
+            for (std::size_t c = 0; c < 8; ++c) {
+                const auto pos = grid.getCornerPos(i, j, k, c);
+                X[c] = pos[0];
+                Y[c] = pos[1];
+                Z[c] = pos[2];
+            }
+
+            const auto center = grid.getCellCenter(g);
+            BOOST_CHECK_CLOSE(center[0], std::accumulate(X.begin(), X.end(), 0.0) / 8.0, 1.0e-12);
+            BOOST_CHECK_CLOSE(center[1], std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0, 1.0e-12);
+            BOOST_CHECK_CLOSE(center[2], std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0, 1.0e-12);
+
+            const double top = (Z[0] + Z[1] + Z[2] + Z[3]) / 4.0;
+            const double bottom = (Z[4] + Z[5] + Z[6] + Z[7]) / 4.0;
+            BOOST_CHECK_CLOSE(grid.getCellDepth(g), (top + bottom) / 2.0, 1.0e-12);
+        }
+    };
+
+    // Single cell path.
+    check_cells();
+    const auto volume = grid.activeVolume();
+    for (std::size_t a = 0; a < grid.getNumActive(); ++a) {
+        BOOST_CHECK_EQUAL(grid.getCellVolume(grid.getGlobalIndex(a)), volume[a]);
+    }
+
+    // Stored geometry.
+    grid.computeActiveGeometry();
+    check_cells();
+    BOOST_CHECK(grid.activeVolume() == volume);
+
+    // The stored geometry is dropped when the active cells change.
+    const auto inactive_volume = grid.getCellVolume(4);
+    grid.resetACTNUM();
+    BOOST_CHECK_EQUAL(grid.activeVolume().size(), grid.getCartesianSize());
+    BOOST_CHECK_CLOSE(grid.activeVolume()[4], inactive_volume, 1.0e-12);
+    check_cells();
+
+    grid.computeActiveGeometry();
+    BOOST_CHECK_CLOSE(grid.activeVolume()[4], inactive_volume, 1.0e-12);
+    check_cells();
+}
@@ -60,6 +60,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace Opm;
@@ -372,6 +373,50 @@ MULTIPLY
                                   expect.begin(), expect.end());
 }
 
+BOOST_AUTO_TEST_CASE(Consecutive_Records_Same_Box)
+{
+    const auto deck = Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 3 1 2 /
+GRID
+EQUALS
+ 'NTG' 1.0 /
+ 'PORO' 0.2 1 3 1 1 1 1 /
+ 'PORO' 0.3 1 3 1 1 1 1 /
+ 'PORO' 0.1 1 3 1 1 2 2 /
+/
+MULTIPLY
+ 'NTG' 0.5 1 3 1 1 2 2 /
+ 'NTG' 0.5 /
+ 'PORO' 2 1 3 1 1 1 1 /
+/
+ADD
+ 'NTG' 0.125 /
+ 'NTG' 0.25 1 3 1 1 1 1 /
+ 'NTG' 0.5 1 3 1 1 1 1 /
+/
+)");
+
+    // Note: 'grid' must be mutable in FieldPropsManager constructor.
+    auto grid = EclipseGrid { 3, 1, 2 };
+
+    const auto fpMgr = FieldPropsManager {
+        deck, Phases{true, true, true}, grid, TableManager{deck}
+    };
+
+    const auto& poro = fpMgr.get_double("PORO");
+    const auto expect_poro = std::vector { 0.6, 0.6, 0.6, 0.1, 0.1, 0.1 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(poro.begin(), poro.end(),
+                                  expect_poro.begin(), expect_poro.end());
+
+    // The second MULTIPLY record uses the box of the preceding record, the
+    // first ADD record the full grid.
+    const auto& ntg = fpMgr.get_double("NTG");
+    const auto expect_ntg = std::vector { 1.875, 1.875, 1.875, 0.375, 0.375, 0.375 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(ntg.begin(), ntg.end(),
+                                  expect_ntg.begin(), expect_ntg.end());
+}
+
 BOOST_AUTO_TEST_CASE(GRID_RESET) {
     std::string deck_string = R"(
 REGIONS
@@ -914,6 +959,67 @@ OPERATE
     BOOST_CHECK_EQUAL(multz[3], 0.75);
 }
 
+BOOST_AUTO_TEST_CASE(Large_Box_Edits) {
+    // More cells than Operate::parallel_size, so the edits run in parallel.
+    // Boxes starting at I=1 cover consecutive cells, those starting at I=2
+    // go through the index list.
+    const std::size_t nx = 64, ny = 32, nz = 20;
+    const std::size_t nc = nx * ny * nz;
+
+    std::vector<double> expect_poro(nc);
+    for (std::size_t g = 0; g < nc; ++g)
+        expect_poro[g] = 0.1 + 0.0001*(g % 1000);
+
+    std::ostringstream deck_string;
+    deck_string << "RUNSPEC\nDIMENS\n " << nx << ' ' << ny << ' ' << nz << " /\n"
+                << "GRID\nPORO\n";
+    for (const auto& poro : expect_poro)
+        deck_string << std::setprecision(17) << poro << '\n';
+    deck_string << "/\nNTG\n " << nc << "*1 /\n" << R"(
+MULTIPLY
+ 'PORO' 0.5 /
+/
+ADD
+ 'PORO' 0.01 2 64 1 32 1 20 /
+/
+MINVALUE
+ 'PORO' 0.06 /
+/
+OPERATE
+ NTG 1 64 1 32 1 20 'MULTA'  PORO 2 0.1 /
+ NTG 2 64 1 32 1 20 'MAXLIM' NTG  0.3 /
+/
+)";
+
+    auto expect_ntg = std::vector<double>(nc);
+    for (std::size_t g = 0; g < nc; ++g) {
+        const bool in_box = (g % nx) > 0;
+
+        auto& poro = expect_poro[g];
+        poro *= 0.5;
+        if (in_box)
+            poro += 0.01;
+        poro = std::max(poro, 0.06);
+
+        expect_ntg[g] = 2*poro + 0.1;
+        if (in_box)
+            expect_ntg[g] = std::min(expect_ntg[g], 0.3);
+    }
+
+    const auto deck = Parser{}.parseString(deck_string.str());
+    EclipseGrid grid(nx, ny, nz);
+    const FieldPropsManager fpm(deck, Phases{true, true, true}, grid, TableManager());
+
+    const auto& poro = fpm.get_double("PORO");
+    const auto& ntg = fpm.get_double("NTG");
+    BOOST_REQUIRE_EQUAL(poro.size(), nc);
+    BOOST_REQUIRE_EQUAL(ntg.size(), nc);
+    for (std::size_t g = 0; g < nc; ++g) {
+        BOOST_CHECK_CLOSE(poro[g], expect_poro[g], 1e-12);
+        BOOST_CHECK_CLOSE(ntg[g], expect_ntg[g], 1e-12);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(EPS_Props_Inconsistent) {
     BOOST_CHECK_THROW(const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
 DIMENS
@@ -3169,3 +3275,52 @@ MULTZ
         BOOST_CHECK_EQUAL(multz2[ij + 100], 40.0);
     }
 }
+
+BOOST_AUTO_TEST_CASE(Packed_Value_Status)
+{
+    using Status = value::status;
+
+    Fieldprops::PackedStatus status(10, Status::uninitialized);
+    BOOST_CHECK_EQUAL(status.size(), 10U);
+
+    status[3] = Status::deck_value;
+    status[9] = Status::valid_default;
+    BOOST_CHECK(std::as_const(status)[3] == Status::deck_value);
+    BOOST_CHECK(std::as_const(status)[9] == Status::valid_default);
+    BOOST_CHECK(std::as_const(status)[2] == Status::uninitialized);
+
+    status.fill(1, 8, Status::empty_default);
+    BOOST_CHECK(std::as_const(status)[0] == Status::uninitialized);
+    BOOST_CHECK(std::as_const(status)[8] == Status::uninitialized);
+    for (std::size_t i = 1; i < 8; ++i) {
+        BOOST_CHECK(std::as_const(status)[i] == Status::empty_default);
+    }
+
+    Fieldprops::compress(status, {true, false, true, true, false, true, true, true, true, true});
+    Fieldprops::PackedStatus expected(8, Status::empty_default);
+    expected[0] = Status::uninitialized;
+    expected[6] = Status::uninitialized;
+    expected[7] = Status::valid_default;
+    BOOST_CHECK(status == expected);
+
+    status.resize(13);
+    BOOST_CHECK(std::as_const(status)[12] == Status::uninitialized);
+    BOOST_CHECK(std::as_const(status)[7] == Status::valid_default);
+
+    status.fill(Status::deck_value);
+    BOOST_CHECK(status.all_of([](const Status st) { return st == Status::deck_value; }));
+    BOOST_CHECK(status == Fieldprops::PackedStatus(13, Status::deck_value));
+
+    // Conversions to and from the unpacked representation.
+    const auto unpacked = std::vector {
+        Status::deck_value, Status::uninitialized, Status::empty_default,
+        Status::valid_default, Status::deck_value,
+    };
+    status = unpacked;
+    BOOST_CHECK_EQUAL(status.size(), unpacked.size());
+    BOOST_CHECK(std::equal(status.begin(), status.end(), unpacked.begin(), unpacked.end()));
+    BOOST_CHECK(status.to_vector() == unpacked);
+
+    const std::vector<Status> converted = status;
+    BOOST_CHECK(converted == unpacked);
+}
@@ -267,6 +267,118 @@ BOOST_AUTO_TEST_CASE(DefaultedRegions) {
   BOOST_CHECK_EQUAL( scanner1.getRegionMultiplier(grid.getGlobalIndex(2,0,0), grid.getGlobalIndex(2,0,1), Opm::FaceDir::ZPlus), 0.75);
 }
 
+BOOST_AUTO_TEST_CASE(BatchedMultipliers) {
+  Opm::Deck deck = createDefaultedRegions();
+  Opm::EclipseGrid grid( deck );
+  Opm::TableManager tm(deck);
+  Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tm);
+
+  std::vector<const Opm::DeckKeyword*> keywords;
+  for (const auto& keyword : deck["MULTREGT"]) {
+      keywords.push_back( &keyword );
+  }
+  const Opm::MULTREGTScanner scanner(grid, &fp, keywords);
+  const Opm::MULTREGTScanner copy(scanner);
+
+  std::vector<std::size_t> cells1, cells2;
+  std::vector<Opm::FaceDir::DirEnum> faceDirs;
+  for (std::size_t k = 0; k < grid.getNZ(); ++k) {
+      for (std::size_t j = 0; j < grid.getNY(); ++j) {
+          for (std::size_t i = 0; i < grid.getNX(); ++i) {
+              const auto g1 = grid.getGlobalIndex(i, j, k);
+              if (i + 1 < grid.getNX()) {
+                  cells1.push_back(g1); cells2.push_back(grid.getGlobalIndex(i + 1, j, k)); faceDirs.push_back(Opm::FaceDir::XPlus);
+              }
+              if (j + 1 < grid.getNY()) {
+                  cells1.push_back(g1); cells2.push_back(grid.getGlobalIndex(i, j + 1, k)); faceDirs.push_back(Opm::FaceDir::YPlus);
+              }
+              if (k + 1 < grid.getNZ()) {
+                  cells1.push_back(g1); cells2.push_back(grid.getGlobalIndex(i, j, k + 1)); faceDirs.push_back(Opm::FaceDir::ZPlus);
+              }
+          }
+      }
+  }
+
+  const auto multipliers = scanner.getRegionMultipliers(cells1, cells2, faceDirs);
+  const auto nnc_multipliers = copy.getRegionMultipliersNNC(cells1, cells2);
+  BOOST_REQUIRE_EQUAL(multipliers.size(), cells1.size());
+  BOOST_REQUIRE_EQUAL(nnc_multipliers.size(), cells1.size());
+
+  for (std::size_t conn = 0; conn < cells1.size(); ++conn) {
+      BOOST_CHECK_EQUAL(multipliers[conn], scanner.getRegionMultiplier(cells1[conn], cells2[conn], faceDirs[conn]));
+      BOOST_CHECK_EQUAL(multipliers[conn], copy.getRegionMultiplier(cells1[conn], cells2[conn], faceDirs[conn]));
+      BOOST_CHECK_EQUAL(nnc_multipliers[conn], scanner.getRegionMultiplierNNC(cells1[conn], cells2[conn]));
+  }
+
+  BOOST_CHECK_THROW(scanner.getRegionMultipliers(cells1, {}, faceDirs), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(WideRegionIdSpan) {
+  // Same regions as in createDefaultedRegions(), with IDs spread out far
+  // enough that the slots are looked up in a hash map.
+  const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 3 3 2 /
+GRID
+DX
+18*0.25 /
+DY
+18*0.25 /
+DZ
+18*0.25 /
+TOPS
+9*0.25 /
+FLUXNUM
+1 1 20000
+1 1 20000
+1 1 20000
+300000 4000000 50000000
+300000 4000000 50000000
+300000 4000000 50000000
+/
+MULTREGT
+300000  4000000   1.25   XYZ   ALL    F /
+20000  -1   0   XYZ   ALL    F /
+1  -1   0   XYZ   ALL    F /
+20000  1   1      XYZ   ALL    F /
+/
+MULTREGT
+20000  *   0.75   XYZ   ALL    F /
+/
+EDIT
+)");
+  const auto dense_deck = createDefaultedRegions();
+
+  Opm::EclipseGrid grid( deck );
+  Opm::TableManager tm(deck);
+  Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tm);
+
+  Opm::EclipseGrid dense_grid( dense_deck );
+  Opm::TableManager dense_tm(dense_deck);
+  Opm::FieldPropsManager dense_fp(dense_deck, Opm::Phases{true, true, true}, dense_grid, dense_tm);
+
+  std::vector<const Opm::DeckKeyword*> keywords, dense_keywords;
+  for (const auto& keyword : deck["MULTREGT"]) {
+      keywords.push_back( &keyword );
+  }
+  for (const auto& keyword : dense_deck["MULTREGT"]) {
+      dense_keywords.push_back( &keyword );
+  }
+  const Opm::MULTREGTScanner scanner(grid, &fp, keywords);
+  const Opm::MULTREGTScanner dense_scanner(dense_grid, &dense_fp, dense_keywords);
+
+  for (std::size_t g1 = 0; g1 < grid.getCartesianSize(); ++g1) {
+      for (std::size_t g2 = 0; g2 < grid.getCartesianSize(); ++g2) {
+          for (const auto faceDir : { Opm::FaceDir::XPlus, Opm::FaceDir::YPlus, Opm::FaceDir::ZPlus }) {
+              BOOST_CHECK_EQUAL(scanner.getRegionMultiplier(g1, g2, faceDir),
+                                dense_scanner.getRegionMultiplier(g1, g2, faceDir));
+          }
+          BOOST_CHECK_EQUAL(scanner.getRegionMultiplierNNC(g1, g2),
+                            dense_scanner.getRegionMultiplierNNC(g1, g2));
+      }
+  }
+}
+
 namespace {
     Opm::Deck createCopyMULTNUMDeck()
     {
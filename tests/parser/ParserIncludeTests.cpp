@@ -23,17 +23,26 @@
 
 #include <boost/version.hpp>
 
+#include <cstddef>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
+
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/json/JsonObject.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/InputErrorAction.hpp>
+#include <opm/input/eclipse/Deck/DeckItem.hpp>
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Deck/DeckRecord.hpp>
 
-#include <iostream>
+#include "tests/WorkArea.hpp"
 
 inline std::string prefix() {
 #if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 71
@@ -147,3 +156,274 @@ BOOST_AUTO_TEST_CASE(ParserKeyword_includeWrongCase) {
 #endif
 }
 
+
+
+namespace {
+
+/*
+  Writes a data keyword with num_tokens tokens, mixing plain values,
+  repeated values and defaulted values, and returns the expected item
+  values along with whether each value is defaulted.
+*/
+template <typename T>
+std::pair<std::vector<T>, std::vector<bool>>
+writeDataKeyword(std::ostream& os, const std::string& name, std::size_t num_tokens)
+{
+    std::vector<T> values;
+    std::vector<bool> defaulted;
+
+    os << name << '\n';
+    for (std::size_t i = 0; i < num_tokens; ++i) {
+        const T value = static_cast<T>(i % 5);
+        if (i % 7 == 0) {
+            os << "3*" << value;
+            values.insert(values.end(), 3, value);
+            defaulted.insert(defaulted.end(), 3, false);
+        }
+        else if (i % 11 == 0) {
+            os << "2*";
+            values.insert(values.end(), 2, T{});
+            defaulted.insert(defaulted.end(), 2, true);
+        }
+        else {
+            os << value;
+            values.push_back(value);
+            defaulted.push_back(false);
+        }
+
+        os << ((i % 10 == 9) ? '\n' : ' ');
+    }
+    os << "/\n";
+
+    return { values, defaulted };
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_includeLargeDataKeywords) {
+    WorkArea work("include_large_data");
+    work.makeSubDir("grid");
+    work.makeSubDir("props");
+
+    const std::size_t num_tokens = 100 * 1000;
+
+    std::pair<std::vector<double>, std::vector<bool>> poro, ntg;
+    std::pair<std::vector<int>, std::vector<bool>> actnum;
+    {
+        std::ofstream os("CASE.DATA");
+        os << "OIL\n"
+           << "INCLUDE\n  'grid/poro.inc' /\n"
+           << "PATHS\n  'PROPS' 'props' /\n/\n"
+           << "INCLUDE\n  '$PROPS/actnum.inc' /\n"
+           << "WATER\n";
+    }
+    {
+        std::ofstream os("grid/poro.inc");
+        poro = writeDataKeyword<double>(os, "PORO", num_tokens);
+        os << "INCLUDE\n  'grid/ntg.inc' /\n";
+    }
+    {
+        std::ofstream os("grid/ntg.inc");
+        ntg = writeDataKeyword<double>(os, "NTG", num_tokens + 17);
+    }
+    {
+        std::ofstream os("props/actnum.inc");
+        actnum = writeDataKeyword<int>(os, "ACTNUM", num_tokens);
+    }
+
+    Opm::Parser parser;
+    const auto deck = parser.parseFile("CASE.DATA");
+
+    const std::vector<std::string> expected_names = { "OIL", "PORO", "NTG", "ACTNUM", "WATER" };
+    BOOST_REQUIRE_EQUAL(deck.size(), expected_names.size());
+    for (std::size_t index = 0; index < deck.size(); ++index)
+        BOOST_CHECK_EQUAL(deck[index].name(), expected_names[index]);
+
+    const auto check_item = [](const Opm::DeckItem& item, const auto& expected)
+    {
+        const auto& [values, defaulted] = expected;
+        using T = typename std::decay_t<decltype(values)>::value_type;
+
+        const auto& data = item.getData<T>();
+        BOOST_REQUIRE_EQUAL(data.size(), values.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            BOOST_CHECK_EQUAL(item.defaultApplied(i), defaulted[i]);
+            if (!defaulted[i])
+                BOOST_CHECK_EQUAL(data[i], values[i]);
+        }
+    };
+
+    check_item(deck["PORO"].back().getRecord(0).getItem(0), poro);
+    check_item(deck["NTG"].back().getRecord(0).getItem(0), ntg);
+    check_item(deck["ACTNUM"].back().getRecord(0).getItem(0), actnum);
+}
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_includeSkippedPrefetch) {
+    // The includes of the ignored GRID section are read ahead but never
+    // reached by the parser.  The includes which are reached must still be
+    // loaded, and in the correct order.
+    WorkArea work("include_skipped_prefetch");
+
+    {
+        std::ofstream os("CASE.DATA");
+        os << "RUNSPEC\n"
+           << "OIL\n"
+           << "GRID\n"
+           << "INCLUDE\n  'grid1.inc' /\n"
+           << "INCLUDE\n  'grid2.inc' /\n"
+           << "INCLUDE\n  'grid3.inc' /\n"
+           << "PROPS\n"
+           << "INCLUDE\n  'props.inc' /\n"
+           << "SOLUTION\n"
+           << "SCHEDULE\n"
+           << "INCLUDE\n  'schedule1.inc' /\n"
+           << "INCLUDE\n  'schedule2.inc' /\n";
+    }
+
+    for (const auto* grid : { "grid1.inc", "grid2.inc", "grid3.inc" }) {
+        std::ofstream os(grid);
+        os << "PORO\n  100*0.25 /\n";
+    }
+    {
+        std::ofstream os("props.inc");
+        os << "DENSITY\n  850 1000 1 /\n";
+    }
+    {
+        std::ofstream os("schedule1.inc");
+        os << "TSTEP\n  1 /\n";
+    }
+    {
+        std::ofstream os("schedule2.inc");
+        os << "TSTEP\n  2 /\n";
+    }
+
+    Opm::Parser parser;
+    Opm::ParseContext parseContext;
+    Opm::ErrorGuard errors;
+    const auto deck = parser.parseFile("CASE.DATA", parseContext, errors,
+                                       { Opm::Ecl::RUNSPEC, Opm::Ecl::PROPS,
+                                         Opm::Ecl::SOLUTION, Opm::Ecl::SCHEDULE });
+
+    BOOST_CHECK(!deck.hasKeyword("PORO"));
+    BOOST_CHECK_EQUAL(deck.count("DENSITY"), std::size_t{1});
+
+    const auto& tstep = deck["TSTEP"];
+    BOOST_REQUIRE_EQUAL(tstep.size(), std::size_t{2});
+    BOOST_CHECK_EQUAL(tstep[0].getRecord(0).getItem(0).get<double>(0), 1.0);
+    BOOST_CHECK_EQUAL(tstep[1].getRecord(0).getItem(0).get<double>(0), 2.0);
+}
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_includeDeckCache) {
+    WorkArea work("include_deck_cache");
+    work.makeSubDir("grid");
+
+    const auto write_data_file = [](const int ntsfun)
+    {
+        std::ofstream os("CASE.DATA");
+        os << "RUNSPEC\n"
+           << "TABDIMS\n  " << ntsfun << " /\n"
+           << "GRID\n"
+           << "INCLUDE\n  'grid/poro.inc' /\n"
+           << "PROPS\n"
+           << "INCLUDE\n  'props.inc' /\n";
+    };
+
+    const auto write_poro = [](const double poro)
+    {
+        std::ofstream os("grid/poro.inc");
+        os << "PORO\n  100*" << poro << " /\n";
+    };
+
+    write_data_file(2);
+    write_poro(0.25);
+    {
+        std::ofstream os("props.inc");
+        os << "SWOF\n"
+           << "  0.2 0 1 0\n  1.0 1 0 0 /\n"
+           << "  0.3 0 1 0\n  1.0 1 0 0 /\n";
+    }
+
+    Opm::ParseContext parseContext;
+    parseContext.update(Opm::ParseContext::PARSE_EXTRA_RECORDS, Opm::InputErrorAction::IGNORE);
+    parseContext.update(Opm::ParseContext::PARSE_RANDOM_TEXT, Opm::InputErrorAction::IGNORE);
+
+    Opm::Parser parser;
+    parser.setDeckCacheDirectory("cache");
+
+    const auto parse = [&parser, &parseContext]()
+    {
+        Opm::ErrorGuard errors;
+        return parser.parseFile("CASE.DATA", parseContext, errors);
+    };
+
+    const auto deck = parse();
+    BOOST_CHECK_EQUAL(std::distance(std::filesystem::directory_iterator("cache"),
+                                    std::filesystem::directory_iterator{}), 2);
+
+    {
+        const auto cached_deck = parse();
+        BOOST_REQUIRE_EQUAL(cached_deck.size(), deck.size());
+        for (std::size_t index = 0; index < deck.size(); ++index) {
+            BOOST_CHECK(cached_deck[index] == deck[index]);
+            BOOST_CHECK_EQUAL(cached_deck[index].location().lineno, deck[index].location().lineno);
+        }
+        BOOST_CHECK_EQUAL(cached_deck["SWOF"].back().size(), 2U);
+    }
+
+    // The number of SWOF tables is given by TABDIMS in the DATA file.
+    write_data_file(1);
+    BOOST_CHECK_EQUAL(parse()["SWOF"].back().size(), 1U);
+
+    write_poro(0.30);
+    {
+        const auto poro_deck = parse();
+        const auto& poro = poro_deck["PORO"].back().getRecord(0).getItem(0).getData<double>();
+        BOOST_REQUIRE_EQUAL(poro.size(), 100U);
+        BOOST_CHECK_CLOSE(poro.front(), 0.30, 1e-8);
+    }
+
+    // TABDIMS may itself come from a cached include file.
+    const auto write_dims = [](const int ntsfun)
+    {
+        std::ofstream os("dims.inc");
+        os << "TABDIMS\n  " << ntsfun << " /\n";
+    };
+
+    {
+        std::ofstream os("CASE.DATA");
+        os << "RUNSPEC\n"
+           << "INCLUDE\n  'dims.inc' /\n"
+           << "GRID\n"
+           << "INCLUDE\n  'grid/poro.inc' /\n"
+           << "PROPS\n"
+           << "INCLUDE\n  'props.inc' /\n";
+    }
+    write_dims(2);
+    BOOST_CHECK_EQUAL(parse()["SWOF"].back().size(), 2U);
+    BOOST_CHECK_EQUAL(parse()["SWOF"].back().size(), 2U);
+
+    write_dims(1);
+    BOOST_CHECK_EQUAL(parse()["SWOF"].back().size(), 1U);
+    BOOST_CHECK_EQUAL(parse()["SWOF"].back().size(), 1U);
+
+    // Entries written by a parser which does not know XKWD must not be
+    // reused by a parser which does.
+    {
+        std::ofstream os("props.inc");
+        os << "XKWD\n  3 /\n";
+    }
+    parseContext.update(Opm::ParseContext::PARSE_UNKNOWN_KEYWORD, Opm::InputErrorAction::IGNORE);
+    BOOST_CHECK(!parse().hasKeyword("XKWD"));
+
+    Opm::Parser xparser;
+    xparser.setDeckCacheDirectory("cache");
+    xparser.addParserKeyword(Json::JsonObject {
+        R"({"name": "XKWD", "sections": ["PROPS"], "size": 1,
+            "items": [{"name": "X", "value_type": "INT"}]})"
+    });
+
+    Opm::ErrorGuard errors;
+    const auto xdeck = xparser.parseFile("CASE.DATA", parseContext, errors);
+    BOOST_REQUIRE(xdeck.hasKeyword("XKWD"));
+    BOOST_CHECK_EQUAL(xdeck["XKWD"].back().getRecord(0).getItem(0).get<int>(0), 3);
+}
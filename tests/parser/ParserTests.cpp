@@ -95,6 +95,26 @@ ParserKeyword createTable(const std::string& name,
     return pkw;
 }
 
+// Scan all tokens of a record one value at a time, through a copy of item
+// with size SINGLE, as reference for the bulk scan of items of size ALL.
+template <typename T>
+std::pair<std::vector<T>, std::vector<value::status>>
+scanSingleValues(ParserItem item, RawRecord record) {
+    item.setSizeType(ParserItem::item_size::SINGLE);
+
+    UnitSystem unit_system;
+    std::vector<T> values;
+    std::vector<value::status> status;
+
+    while (record.size() > 0) {
+        const auto deckItem = item.scan(record, unit_system, unit_system);
+        values.push_back(deckItem.getData<T>().front());
+        status.push_back(deckItem.getValueStatus().front());
+    }
+
+    return { values, status };
+}
+
 }
 
 BOOST_AUTO_TEST_SUITE(General_Facilities)
@@ -702,6 +722,52 @@ BOOST_AUTO_TEST_CASE(Scan_All_WithDefaults) {
     BOOST_CHECK_EQUAL(25, deckIntItem.get< int >(21));
 }
 
+BOOST_AUTO_TEST_CASE(Scan_All_MixedStarTokens_MatchesSingleScan) {
+    // Enough tokens to span several chunks of the bulk scanner
+    std::string intData, doubleData;
+    for (int i = 0; i < 25000; ++i) {
+        intData += "3* 2*15 1* 7 4*2 ";
+        doubleData += "3* 2*1.5 1* 0.25 4*2d1 ";
+    }
+
+    const RawRecord intRecord(intData, KeywordLocation("KW", "File", 100));
+    const RawRecord doubleRecord(doubleData, KeywordLocation("KW", "File", 100));
+    UnitSystem unit_system;
+
+    for (const bool withDefault : { false, true }) {
+        ParserItem itemInt("ITEM", INT);
+        ParserItem itemDouble("ITEM", DOUBLE);
+
+        if (withDefault) {
+            itemInt.setDefault(42);
+            itemDouble.setDefault(4.2);
+        }
+
+        itemInt.setSizeType(ParserItem::item_size::ALL);
+        itemDouble.setSizeType(ParserItem::item_size::ALL);
+
+        {
+            auto record = intRecord;
+            const auto bulk = itemInt.scan(record, unit_system, unit_system);
+            const auto [values, status] = scanSingleValues<int>(itemInt, intRecord);
+
+            BOOST_CHECK_EQUAL(bulk.data_size(), 25000U * 11);
+            BOOST_CHECK(bulk.getData<int>() == values);
+            BOOST_CHECK(bulk.getValueStatus() == status);
+        }
+
+        {
+            auto record = doubleRecord;
+            const auto bulk = itemDouble.scan(record, unit_system, unit_system);
+            const auto [values, status] = scanSingleValues<double>(itemDouble, doubleRecord);
+
+            BOOST_CHECK_EQUAL(bulk.data_size(), 25000U * 11);
+            BOOST_CHECK(bulk.getData<double>() == values);
+            BOOST_CHECK(bulk.getValueStatus() == status);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(Scan_SINGLE_CorrectIntSetInDeckItem) {
     ParserItem itemInt(std::string("ITEM2"), INT);
 
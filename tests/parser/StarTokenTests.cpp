@@ -125,3 +125,23 @@ BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "123*456" ) ) );
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "'123*456'" ) ) );
 }
+
+BOOST_AUTO_TEST_CASE( StarTokenViews ) {
+    std::string_view countString, valueString;
+    BOOST_CHECK( Opm::isStarToken("3*2.5D1", countString, valueString) );
+    BOOST_CHECK_EQUAL( "3", countString );
+    BOOST_CHECK_EQUAL( "2.5D1", valueString );
+    BOOST_CHECK_EQUAL( 3U, Opm::starTokenCount("3*2.5D1", countString, valueString) );
+    BOOST_CHECK_CLOSE( 25.0, Opm::readValueToken<double>( valueString ), 1e-6 );
+
+    BOOST_CHECK( Opm::isStarToken("*", countString, valueString) );
+    BOOST_CHECK_EQUAL( 1U, Opm::starTokenCount("*", countString, valueString) );
+
+    BOOST_CHECK( Opm::isStarToken("*1", countString, valueString) );
+    BOOST_CHECK_THROW( Opm::starTokenCount("*1", countString, valueString), std::invalid_argument );
+
+    BOOST_CHECK( Opm::isStarToken("0*", countString, valueString) );
+    BOOST_CHECK_THROW( Opm::starTokenCount("0*", countString, valueString), std::invalid_argument );
+
+    BOOST_CHECK( !Opm::isStarToken("12", countString, valueString) );
+}
@@ -36,8 +36,13 @@
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <cstddef>
 #include <stdexcept>
 #include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -90,6 +95,154 @@ MULTZ
     BOOST_CHECK_EQUAL( transMult.getMultiplier(0,0,0 , Opm::FaceDir::ZPlus) , 4.0 );
 }
 
+BOOST_AUTO_TEST_CASE(FinalizedBatch)
+{
+    Opm::EclipseGrid grid(3,3,3);
+    Opm::FieldPropsManager fp(Opm::Deck(), Opm::Phases{true, true, true}, grid, Opm::TableManager());
+    Opm::TransMult transMult(grid, {}, fp);
+
+    std::vector<double> multx(27), multz_minus(27);
+    for (std::size_t g = 0; g < 27; ++g) {
+        multx[g] = 1.0 + 0.1*g;
+        multz_minus[g] = 2.0 - 0.05*g;
+    }
+    transMult.applyMULT(multx, Opm::FaceDir::XPlus);
+    transMult.applyMULT(multz_minus, Opm::FaceDir::ZMinus);
+
+    const std::vector<std::size_t> cells1 { 0, 1, 4, 13, 13, 0, 26 };
+    const std::vector<std::size_t> cells2 { 1, 0, 13, 4, 22, 2, 25 };
+    const std::vector<Opm::FaceDir::DirEnum> faceDirs {
+        Opm::FaceDir::XPlus, Opm::FaceDir::XMinus, Opm::FaceDir::ZPlus,
+        Opm::FaceDir::ZMinus, Opm::FaceDir::ZPlus, Opm::FaceDir::XPlus,
+        Opm::FaceDir::XMinus,
+    };
+    const std::vector<double> expected {
+        multx[0], multx[0], multz_minus[13], multz_minus[13],
+        multz_minus[22], multx[0], multx[25],
+    };
+
+    std::vector<double> trans(cells1.size(), 2.0);
+    transMult.applyMultipliers(cells1, cells2, faceDirs, trans);
+    for (std::size_t conn = 0; conn < trans.size(); ++conn) {
+        BOOST_CHECK_CLOSE(trans[conn], 2.0 * expected[conn], 1.0e-12);
+    }
+
+    BOOST_CHECK(!transMult.finalized());
+    transMult.finalize();
+    BOOST_CHECK(transMult.finalized());
+
+    std::vector<double> trans_finalized(cells1.size(), 2.0);
+    transMult.applyMultipliers(cells1, cells2, faceDirs, trans_finalized);
+    for (std::size_t conn = 0; conn < trans.size(); ++conn) {
+        BOOST_CHECK_CLOSE(trans_finalized[conn], trans[conn], 1.0e-12);
+    }
+
+    // Modifying the multipliers leaves finalized mode.
+    transMult.applyMULT(multx, Opm::FaceDir::YPlus);
+    BOOST_CHECK(!transMult.finalized());
+
+    BOOST_CHECK_THROW(transMult.applyMultipliers(cells1, cells2, faceDirs, trans_finalized = {}),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(FinalizedBatch_MULTREGT)
+{
+    const auto es = Opm::EclipseState {
+        Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+  3 3 2 /
+GRID
+DX
+  18*0.25 /
+DY
+  18*0.25 /
+DZ
+  18*0.25 /
+TOPS
+  9*0.25 /
+PORO
+  18*0.3 /
+PERMX
+  18*100.0 /
+MULTX
+  1.0 0.5 1.0  2.0 1.0 1.0  1.0 1.0 0.25
+  9*1.0 /
+FLUXNUM
+  1 1 2
+  1 1 2
+  3 3 2
+  4 4 5
+  4 4 5
+  4 4 5
+/
+MULTREGT
+  1 2 0.5  XYZ ALL F /
+  2 5 0.1  Z   ALL F /
+  3 4 0.75 XYZ NNC F /
+/
+END
+)")
+    };
+
+    auto transMult = es.getTransMult();
+    const auto& grid = es.getInputGrid();
+
+    std::vector<std::size_t> cells1, cells2;
+    std::vector<Opm::FaceDir::DirEnum> faceDirs;
+    for (std::size_t k = 0; k < grid.getNZ(); ++k) {
+        for (std::size_t j = 0; j < grid.getNY(); ++j) {
+            for (std::size_t i = 0; i < grid.getNX(); ++i) {
+                const auto g = grid.getGlobalIndex(i, j, k);
+                if (i + 1 < grid.getNX()) {
+                    cells1.push_back(g); cells2.push_back(grid.getGlobalIndex(i + 1, j, k)); faceDirs.push_back(Opm::FaceDir::XPlus);
+                }
+                if (j + 1 < grid.getNY()) {
+                    cells1.push_back(grid.getGlobalIndex(i, j + 1, k)); cells2.push_back(g); faceDirs.push_back(Opm::FaceDir::YMinus);
+                }
+                if (k + 1 < grid.getNZ()) {
+                    cells1.push_back(g); cells2.push_back(grid.getGlobalIndex(i, j, k + 1)); faceDirs.push_back(Opm::FaceDir::ZPlus);
+                }
+            }
+        }
+    }
+
+    // A connection between cells which are not Cartesian neighbours.
+    cells1.push_back(6); cells2.push_back(15); faceDirs.push_back(Opm::FaceDir::ZPlus);
+
+    std::vector<double> trans(cells1.size(), 2.0);
+    transMult.applyMultipliers(cells1, cells2, faceDirs, trans);
+
+    transMult.finalize();
+    BOOST_REQUIRE(transMult.finalized());
+
+    std::vector<double> trans_finalized(cells1.size(), 2.0);
+    transMult.applyMultipliers(cells1, cells2, faceDirs, trans_finalized);
+    for (std::size_t conn = 0; conn < trans.size(); ++conn) {
+        BOOST_CHECK_CLOSE(trans_finalized[conn], trans[conn], 1.0e-12);
+    }
+
+    // The combined face multipliers are part of the serialized state, and
+    // unpacking replaces those of the target object.
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+    ser.pack(transMult);
+
+    Opm::TransMult copy;
+    ser.unpack(copy);
+    BOOST_CHECK(copy.finalized());
+    BOOST_CHECK(copy == transMult);
+
+    std::vector<double> trans_copy(cells1.size(), 2.0);
+    copy.applyMultipliers(cells1, cells2, faceDirs, trans_copy);
+    for (std::size_t conn = 0; conn < trans.size(); ++conn) {
+        BOOST_CHECK_CLOSE(trans_copy[conn], trans[conn], 1.0e-12);
+    }
+
+    ser.pack(es.getTransMult());
+    ser.unpack(copy);
+    BOOST_CHECK(!copy.finalized());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Basic_Operations
 
 // ---------------------------------------------------------------------------
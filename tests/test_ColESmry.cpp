@@ -0,0 +1,250 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE Test ColESmry
+#include <boost/test/unit_test.hpp>
+
+#include <opm/io/eclipse/ColESmry.hpp>
+#include <opm/io/eclipse/ColSmryFormat.hpp>
+#include <opm/io/eclipse/ColSmryOutput.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+using Opm::EclIO::ColESmry;
+using Opm::EclIO::ColSmryOutput;
+using Opm::EclIO::ESmry;
+
+namespace {
+
+ColSmryOutput::Options makeOptions(int chunkSize, bool compress)
+{
+    auto options = ColSmryOutput::defaultOptions();
+    options.chunkSize = chunkSize;
+    options.compress = compress;
+    options.flushInterval = std::chrono::hours{1};
+
+    return options;
+}
+
+std::vector<int> reportStepFlags(const ESmry& smry)
+{
+    const auto nstep = smry.numberOfTimeSteps();
+    const auto time = smry.get("TIME");
+    const auto rtime = smry.get_at_rstep("TIME");
+
+    std::vector<int> flags(nstep, 0);
+    for (std::size_t n = 0; n < nstep; n++)
+        flags[n] = std::find(rtime.begin(), rtime.end(), time[n]) != rtime.end();
+
+    return flags;
+}
+
+// Write all time steps of smry to a columnar summary file.
+void copySummary(const ESmry& smry, const std::string& filename,
+                 const ColSmryOutput::Options& options)
+{
+    const auto& keys = smry.keywordList();
+
+    std::vector<std::string> units;
+    for (const auto& key : keys)
+        units.push_back(smry.get_unit(key));
+
+    smry.loadData();
+
+    const auto flags = reportStepFlags(smry);
+    const auto nstep = smry.numberOfTimeSteps();
+
+    ColSmryOutput output(filename, keys, units, smry.start_v(), "", 0, options);
+
+    std::vector<float> ts_data(keys.size());
+
+    for (std::size_t t = 0; t < nstep; t++) {
+        for (std::size_t k = 0; k < keys.size(); k++)
+            ts_data[k] = smry.get(keys[k])[t];
+
+        output.write(ts_data, flags[t], t == nstep - 1);
+    }
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ColumnCodec)
+{
+    using namespace Opm::EclIO::ColSmry;
+
+    std::vector<std::uint32_t> words(1000, 0);
+    for (std::size_t i = 500; i < words.size(); i++)
+        words[i] = static_cast<std::uint32_t>(i*i*2654435761U);
+
+    for (const bool compress : { false, true }) {
+        const auto column = encodeColumn(words.data(), words.size(), compress);
+
+        std::vector<std::uint32_t> decoded(words.size());
+        decodeColumn(column.data(), column.size(), decoded.data(), decoded.size());
+
+        BOOST_CHECK(decoded == words);
+        BOOST_CHECK_EQUAL(column.size() < 4*words.size(), compress);
+
+        // corrupt column sizes are detected
+
+        BOOST_CHECK_THROW(decodeColumn(column.data(), column.size() - 1, decoded.data(), decoded.size()),
+                          std::runtime_error);
+    }
+
+    const std::vector<std::uint32_t> constant(1024, 0x42c80000);
+    const auto column = encodeColumn(constant.data(), constant.size(), true);
+
+    BOOST_CHECK_LT(column.size(), 64U);
+}
+
+BOOST_AUTO_TEST_CASE(ColESmry_SPE1)
+{
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    ESmry smry("SPE1CASE1.SMSPEC");
+
+    for (const bool compress : { false, true }) {
+        // 123 time steps, the last chunk is partially filled
+        copySummary(smry, "SPE1CASE1.CSMRY", makeOptions(10, compress));
+
+        ColESmry csmry("SPE1CASE1");
+
+        BOOST_CHECK_EQUAL(csmry.numberOfTimeSteps(), smry.numberOfTimeSteps());
+        BOOST_CHECK_EQUAL(csmry.numberOfVectors(), smry.keywordList().size());
+        BOOST_CHECK(csmry.keywordList() == smry.keywordList());
+        BOOST_CHECK(csmry.start_v() == smry.start_v());
+        BOOST_CHECK(csmry.startdate() == smry.startdate());
+        BOOST_CHECK(csmry.keywordList("WBHP*") == smry.keywordList("WBHP*"));
+
+        BOOST_CHECK(csmry.get("WGPR:PROD") == smry.get("WGPR:PROD"));
+        BOOST_CHECK(csmry.get_at_rstep("FGOR") == smry.get_at_rstep("FGOR"));
+        BOOST_CHECK_EQUAL(csmry.get_unit("WBHP:PROD"), smry.get_unit("WBHP:PROD"));
+
+        csmry.loadData();
+
+        for (const auto& key : smry.keywordList())
+            BOOST_CHECK_MESSAGE(csmry.get(key) == smry.get(key), "vector " << key);
+
+        BOOST_CHECK_THROW(csmry.get("NO_SUCH_KEY"), std::invalid_argument);
+        BOOST_CHECK_THROW(csmry.get_unit("NO_SUCH_KEY"), std::invalid_argument);
+    }
+
+    BOOST_CHECK_THROW(ColESmry("SPE1CASE1.UNSMRY"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(ColESmry_LiveRun)
+{
+    WorkArea work;
+
+    const std::vector<std::string> keys { "TIME", "FOPR", "WBHP:OP_1" };
+    const std::vector<std::string> units { "DAYS", "SM3/DAY", "BARSA" };
+
+    auto output = std::make_unique<ColSmryOutput>("LIVE.CSMRY", keys, units,
+                                                  std::vector<int>{ 1, 1, 2020, 0, 0, 0, 0 },
+                                                  "BASE", 12, makeOptions(10, true));
+
+    // directory only
+    {
+        ColESmry csmry("LIVE.CSMRY");
+        BOOST_CHECK_EQUAL(csmry.numberOfTimeSteps(), 0U);
+        BOOST_CHECK_EQUAL(csmry.numberOfVectors(), 3U);
+        BOOST_CHECK(csmry.get("FOPR").empty());
+        BOOST_CHECK_EQUAL(std::get<0>(csmry.restart_info()), "BASE");
+        BOOST_CHECK_EQUAL(std::get<1>(csmry.restart_info()), 12);
+    }
+
+    for (int t = 0; t < 25; t++) {
+        const auto tf = static_cast<float>(t);
+        output->write({ tf, 100.0f, 200.0f + tf }, t % 5 == 0, false);
+    }
+
+    // only complete chunks are visible, i.e., 20 of 25 steps
+
+    {
+        ColESmry csmry("LIVE.CSMRY");
+        BOOST_CHECK_EQUAL(csmry.numberOfTimeSteps(), 20U);
+        BOOST_CHECK_EQUAL(csmry.get("WBHP:OP_1").back(), 219.0f);
+        BOOST_CHECK_EQUAL(csmry.get_at_rstep("TIME").size(), 4U);
+    }
+
+    // reader following the run, with one vector loaded
+
+    ColESmry live("LIVE.CSMRY");
+    BOOST_CHECK_EQUAL(live.get("WBHP:OP_1").size(), 20U);
+    BOOST_CHECK_EQUAL(live.refresh(), 0U);
+
+    // a partially written record at the end of the file is ignored
+
+    const auto size = std::filesystem::file_size("LIVE.CSMRY");
+    {
+        std::ofstream os("LIVE.CSMRY", std::ios::binary | std::ios::app);
+
+        const Opm::EclIO::ColSmry::RecordHeader header {
+            static_cast<std::uint32_t>(Opm::EclIO::ColSmry::RecordKind::Chunk), 0, 1000
+        };
+
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        os.write("partial", 7);
+    }
+
+    {
+        ColESmry csmry("LIVE.CSMRY");
+        BOOST_CHECK_EQUAL(csmry.numberOfTimeSteps(), 20U);
+    }
+
+    BOOST_CHECK_EQUAL(live.refresh(), 0U);
+
+    std::filesystem::resize_file("LIVE.CSMRY", size);
+
+    output.reset();
+
+    ColESmry csmry("LIVE.CSMRY");
+    BOOST_CHECK_EQUAL(csmry.numberOfTimeSteps(), 25U);
+
+    const auto& time = csmry.get("TIME");
+    for (int t = 0; t < 25; t++)
+        BOOST_CHECK_EQUAL(time[t], static_cast<float>(t));
+
+    BOOST_CHECK(csmry.get("FOPR") == std::vector<float>(25, 100.0f));
+
+    const auto dates = csmry.dates();
+    BOOST_CHECK(dates.back() - dates.front() == std::chrono::hours(24*24));
+
+    // the final chunk is picked up by refresh(), for loaded vectors too
+
+    BOOST_CHECK_EQUAL(live.refresh(), 5U);
+    BOOST_CHECK_EQUAL(live.numberOfTimeSteps(), 25U);
+    BOOST_CHECK(live.get("WBHP:OP_1") == csmry.get("WBHP:OP_1"));
+    BOOST_CHECK(live.get("TIME") == time);
+    BOOST_CHECK(live.get_at_rstep("TIME") == csmry.get_at_rstep("TIME"));
+    BOOST_CHECK_EQUAL(live.refresh(), 0U);
+}
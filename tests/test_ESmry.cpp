@@ -30,9 +30,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <tuple>
 
 #include <math.h>
@@ -640,3 +643,107 @@ BOOST_AUTO_TEST_CASE(Test_all_available_w_restart) {
 
     BOOST_CHECK_EQUAL( smry3.all_steps_available(), false);
 }
+
+BOOST_AUTO_TEST_CASE(Test_refresh) {
+
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    Opm::EclIO::ESmry ref("SPE1CASE1.SMSPEC");
+    ref.loadData();
+
+    std::vector<char> unsmry;
+    {
+        std::ifstream is("SPE1CASE1.UNSMRY", std::ios::binary);
+        unsmry.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    }
+
+    // Simulate an active run by writing the data file in pieces which
+    // generally do not end on record boundaries.
+    auto write_until = [&unsmry](std::size_t size) {
+        std::ofstream os("SPE1CASE1.UNSMRY", std::ios::binary | std::ios::trunc);
+        os.write(unsmry.data(), std::min(size, unsmry.size()));
+    };
+
+    write_until(unsmry.size() / 3 + 7);
+
+    Opm::EclIO::ESmry smry("SPE1CASE1.SMSPEC");
+
+    const auto nInitial = smry.numberOfTimeSteps();
+    BOOST_CHECK(nInitial > 0);
+    BOOST_CHECK(nInitial < ref.numberOfTimeSteps());
+
+    smry.get("TIME");
+    smry.get("WGPR:PROD");
+    BOOST_CHECK(smry.all_steps_available());
+
+    BOOST_CHECK_EQUAL(smry.refresh(), 0U);
+
+    auto nSteps = nInitial;
+    for (const auto size : { unsmry.size() / 2, unsmry.size() / 2 + 1, 2 * unsmry.size() / 3 + 101, unsmry.size() }) {
+        write_until(size);
+        nSteps += smry.refresh();
+
+        BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), nSteps);
+        BOOST_CHECK_EQUAL(smry.get("TIME").size(), nSteps);
+    }
+
+    BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), ref.numberOfTimeSteps());
+    BOOST_CHECK(smry.all_steps_available());
+
+    // Loaded before refresh and loaded after refresh
+    for (const auto* key : { "TIME", "WGPR:PROD", "FGOR", "WBHP:INJ" }) {
+        const auto& vect = smry.get(key);
+        const auto& ref_vect = ref.get(key);
+        BOOST_CHECK_EQUAL_COLLECTIONS(vect.begin(), vect.end(), ref_vect.begin(), ref_vect.end());
+    }
+
+    const auto rstep = smry.get_at_rstep("TIME");
+    const auto ref_rstep = ref.get_at_rstep("TIME");
+    BOOST_CHECK_EQUAL_COLLECTIONS(rstep.begin(), rstep.end(), ref_rstep.begin(), ref_rstep.end());
+}
+
+BOOST_AUTO_TEST_CASE(Test_loadData_vectors_w_restart) {
+
+    // Vectors requested by name are read concurrently, per data file, and
+    // must match those of the base and restarted runs loaded separately.
+    // Vectors not defined in one of the runs are NaN for its time steps.
+
+    ESmry base("SPE1CASE1.SMSPEC");
+    base.loadData();
+
+    ESmry rst("SPE1CASE1_RST60.SMSPEC");
+    rst.loadData();
+
+    ESmry smry("SPE1CASE1_RST60.SMSPEC", true);
+
+    auto keys = smry.keywordList();
+    keys.push_back(keys.front());
+
+    smry.loadData(keys);
+
+    const auto nBase = smry.numberOfTimeSteps() - rst.numberOfTimeSteps();
+    BOOST_CHECK(nBase > 0);
+
+    for (const auto& key : smry.keywordList()) {
+        const auto& vect = smry.get(key);
+        BOOST_REQUIRE_EQUAL(vect.size(), smry.numberOfTimeSteps());
+
+        for (std::size_t n = 0; n < nBase; n++) {
+            if (base.hasKey(key))
+                BOOST_CHECK_MESSAGE(vect[n] == base.get(key)[n], "vector " << key << ", time step " << n);
+            else
+                BOOST_CHECK_MESSAGE(std::isnan(vect[n]), "vector " << key << ", time step " << n);
+        }
+
+        for (std::size_t n = nBase; n < vect.size(); n++) {
+            if (rst.hasKey(key))
+                BOOST_CHECK_MESSAGE(vect[n] == rst.get(key)[n - nBase], "vector " << key << ", time step " << n);
+            else
+                BOOST_CHECK_MESSAGE(std::isnan(vect[n]), "vector " << key << ", time step " << n);
+        }
+    }
+
+    BOOST_CHECK(std::get<1>(smry.get_io_elapsed()) > 0.0);
+}
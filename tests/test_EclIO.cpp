@@ -21,6 +21,7 @@
 #define BOOST_TEST_MODULE Test EclIO
 #include <boost/test/unit_test.hpp>
 
+#include <opm/io/eclipse/ByteSwap.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 
@@ -33,6 +34,7 @@
 #include <limits>
 #include <tuple>
 #include <cmath>
+#include <cstring>
 #include <numeric>
 
 #include <math.h>
@@ -92,6 +94,45 @@ void write_header(std::ofstream& ofileH, const std::string& arrName,
 
 } // Anonymous namespace
 
+BOOST_AUTO_TEST_CASE(TestByteSwap)
+{
+    // sizes not multiple of the vector width exercise the scalar tail
+
+    for (const std::size_t n : { 0, 1, 7, 8, 9, 31, 1000, 1027 }) {
+        std::vector<int> inte(n);
+        std::vector<double> doub(n);
+
+        for (std::size_t i = 0; i < n; i++) {
+            inte[i] = static_cast<int>(i*2654435761U);
+            doub[i] = -1.5*i + 1.0e-3;
+        }
+
+        std::vector<int> inte_swapped(n);
+        std::vector<double> doub_swapped(n);
+
+        byteSwap32(inte.data(), inte_swapped.data(), n);
+        byteSwap64(doub.data(), doub_swapped.data(), n);
+
+        for (std::size_t i = 0; i < n; i++) {
+            BOOST_CHECK_EQUAL(inte_swapped[i], flipEndianInt(inte[i]));
+
+            const auto ref = flipEndianDouble(doub[i]);
+            BOOST_CHECK_EQUAL(std::memcmp(&doub_swapped[i], &ref, sizeof(ref)), 0);
+        }
+
+        // in place conversion restores the original values
+
+        byteSwap32(inte_swapped.data(), inte_swapped.data(), n);
+        byteSwap64(doub_swapped.data(), doub_swapped.data(), n);
+
+        BOOST_CHECK(inte_swapped == inte);
+        BOOST_CHECK(doub_swapped == doub);
+    }
+
+    const auto kernel = byteSwapKernel();
+    BOOST_CHECK(kernel == "avx2" || kernel == "ssse3" || kernel == "scalar");
+}
+
 BOOST_AUTO_TEST_CASE(TestEclFile_X231)
 {
     WorkArea work;
@@ -265,6 +306,152 @@ BOOST_AUTO_TEST_CASE(TestEclFile_IX)
         BOOST_CHECK_EQUAL(refLogihead[n], logih[n]);
 }
 
+BOOST_AUTO_TEST_CASE(TestEclFile_MemoryMapped)
+{
+    std::string testFile="ECLFILE.INIT";
+
+    // memory mapped mode not supported for formatted files
+
+    BOOST_CHECK_THROW(EclFile file1("ECLFILE.FINIT", EclFile::MemoryMapped{true}), std::invalid_argument);
+
+    EclFile file1(testFile);
+    EclFile file2(testFile, EclFile::MemoryMapped{true});
+
+    BOOST_CHECK_EQUAL(file1.memoryMapped(), false);
+    BOOST_CHECK_EQUAL(file2.memoryMapped(), true);
+
+    BOOST_CHECK_THROW(file1.view<int>("ICON"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.view<float>("ICON"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.view<int>("XXXX"), std::invalid_argument);
+
+    // views span several on-disk blocks (PORV has 3146 elements)
+
+    auto icon = file2.view<int>("ICON");
+    auto logih = file2.view<bool>("LOGIHEAD");
+    auto porv = file2.view<float>("PORV");
+    auto xcon = file2.view<double>("XCON");
+
+    BOOST_CHECK_EQUAL(icon.size(), 1875U);
+    BOOST_CHECK_EQUAL(porv.size(), 3146U);
+
+    BOOST_CHECK(std::equal(icon.begin(), icon.end(), file1.get<int>("ICON").begin()));
+    BOOST_CHECK(std::equal(logih.begin(), logih.end(), file1.get<bool>("LOGIHEAD").begin()));
+    BOOST_CHECK(std::equal(porv.begin(), porv.end(), file1.get<float>("PORV").begin()));
+    BOOST_CHECK(std::equal(xcon.begin(), xcon.end(), file1.get<double>("XCON").begin()));
+
+    BOOST_CHECK(porv.to_vector() == file1.get<float>("PORV"));
+    BOOST_CHECK(xcon.to_vector() == file1.get<double>("XCON"));
+
+    // get() in memory mapped mode decodes from the mapping
+
+    BOOST_CHECK(file2.get<float>(2) == file1.get<float>(2));
+    BOOST_CHECK(file2.get<std::string>("KEYWORDS") == file1.get<std::string>("KEYWORDS"));
+
+    // IX representation of logical true values
+
+    EclFile file3("MODEL1_IX.INIT", EclFile::MemoryMapped{true});
+    EclFile file4("MODEL1_IX.INIT");
+
+    auto ix_logih = file3.view<bool>("LOGIHEAD");
+    BOOST_CHECK(ix_logih.to_vector() == file4.get<bool>("LOGIHEAD"));
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_LoadBatch)
+{
+    // batched loading of many arrays must give the same result as loading
+    // each array on its own, from both stream and memory mapped files
+
+    for (const auto& testFile : { "ECLFILE.INIT", "MODEL1_IX.INIT" }) {
+        EclFile ref(testFile);
+        EclFile file1(testFile);
+        EclFile file2(testFile, EclFile::MemoryMapped{true});
+
+        const auto arrayList = file1.getList();
+
+        std::vector<int> indices(arrayList.size());
+        std::iota(indices.rbegin(), indices.rend(), 0);
+
+        file1.loadData(indices);
+        file2.loadData();
+
+        for (std::size_t n = 0; n < arrayList.size(); n++) {
+            ref.loadData(static_cast<int>(n));
+
+            switch (std::get<1>(arrayList[n])) {
+            case INTE:
+                BOOST_CHECK(file1.get<int>(n) == ref.get<int>(n));
+                BOOST_CHECK(file2.get<int>(n) == ref.get<int>(n));
+                break;
+            case REAL:
+                BOOST_CHECK(file1.get<float>(n) == ref.get<float>(n));
+                BOOST_CHECK(file2.get<float>(n) == ref.get<float>(n));
+                break;
+            case DOUB:
+                BOOST_CHECK(file1.get<double>(n) == ref.get<double>(n));
+                BOOST_CHECK(file2.get<double>(n) == ref.get<double>(n));
+                break;
+            case LOGI:
+                BOOST_CHECK(file1.get<bool>(n) == ref.get<bool>(n));
+                BOOST_CHECK(file2.get<bool>(n) == ref.get<bool>(n));
+                break;
+            case CHAR:
+            case C0NN:
+                BOOST_CHECK(file1.get<std::string>(n) == ref.get<std::string>(n));
+                BOOST_CHECK(file2.get<std::string>(n) == ref.get<std::string>(n));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_LoadBatchLarge)
+{
+    // arrays spanning many read chunks are assembled correctly, also when
+    // the last chunk and the last block are only partly filled
+
+    const std::size_t size = 150001;
+
+    std::vector<int> ivect(size);
+    std::vector<float> fvect(size);
+    std::vector<double> dvect(size);
+    std::vector<bool> bvect(size);
+
+    for (std::size_t i = 0; i < size; i++) {
+        ivect[i] = static_cast<int>(i) - 7;
+        fvect[i] = 0.5f * static_cast<float>(i);
+        dvect[i] = 1.0 / static_cast<double>(i + 1);
+        bvect[i] = (i % 3) == 0;
+    }
+
+    WorkArea work;
+    {
+        EclOutput eclTest("LARGE.INIT", false);
+
+        eclTest.write("IVECT", ivect);
+        eclTest.write("FVECT", fvect);
+        eclTest.write("DVECT", dvect);
+        eclTest.write("BVECT", bvect);
+    }
+
+    EclFile file1("LARGE.INIT");
+    EclFile file2("LARGE.INIT", EclFile::MemoryMapped{true});
+
+    file1.loadData();
+    file2.loadData();
+
+    BOOST_CHECK(file1.get<int>("IVECT") == ivect);
+    BOOST_CHECK(file1.get<float>("FVECT") == fvect);
+    BOOST_CHECK(file1.get<double>("DVECT") == dvect);
+    BOOST_CHECK(file1.get<bool>("BVECT") == bvect);
+
+    BOOST_CHECK(file2.get<int>("IVECT") == ivect);
+    BOOST_CHECK(file2.get<float>("FVECT") == fvect);
+    BOOST_CHECK(file2.get<double>("DVECT") == dvect);
+    BOOST_CHECK(file2.get<bool>("BVECT") == bvect);
+}
+
 BOOST_AUTO_TEST_CASE(TestEcl_Write_binary)
 {
     std::string inputFile="ECLFILE.INIT";
@@ -22,13 +22,18 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/output/eclipse/EclipseIO.hpp>
+#include <opm/output/eclipse/Inplace.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
+#include <opm/output/eclipse/Summary.hpp>
 
 #include <opm/output/data/Cells.hpp>
+#include <opm/output/data/Groups.hpp>
+#include <opm/output/data/Wells.hpp>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EGrid.hpp>
 #include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
@@ -252,11 +257,9 @@ time_t ecl_util_make_date( const int day, const int month, const int year )
     return static_cast<time_t>(asTimeT(Opm::TimeStampUTC{ymd}));
 }
 
-} // Anonymous namespace
-
-BOOST_AUTO_TEST_CASE(EclipseIOIntegration)
+std::string integrationDeck()
 {
-    const auto deckString = std::string { R"(RUNSPEC
+    return { R"(RUNSPEC
 UNIFOUT
 OIL
 GAS
@@ -302,6 +305,13 @@ WELSPECS
 'PROD' 'G' 3 3 1000 'OIL' /
 /
 )" };
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(EclipseIOIntegration)
+{
+    const auto deckString = integrationDeck();
 
     auto write_and_check = [&deckString]( int first = 1, int last = 5 ) {
         const auto deck = Parser().parseString( deckString);
@@ -437,6 +447,129 @@ WELSPECS
     BOOST_CHECK_EQUAL(file_size, write_and_check(3, 5));
 }
 
+BOOST_AUTO_TEST_CASE(EclipseIOAsyncOutput)
+{
+    WorkArea work_area("test_ecl_writer_async");
+
+    auto deckString = integrationDeck();
+    deckString.insert(deckString.find("SCHEDULE"), "SUMMARY\nFPR\nFOPR\n");
+    const auto deck = Parser().parseString(deckString);
+
+    // Writes report steps 1..5, each preceded by a substep, to the result
+    // set 'base_name'.  Returns the summary state of the caller.
+    auto run = [&deck](const std::string& base_name, const bool async)
+    {
+        auto es = EclipseState( deck );
+        const auto& eclGrid = es.getInputGrid();
+        const Schedule schedule(deck, es, std::make_shared<Python>());
+        const SummaryConfig summary_config( deck, schedule, es.fieldProps(), es.aquifer());
+        SummaryState st(TimeService::now(), 0.0);
+        es.getIOConfig().setBaseName( base_name );
+
+        EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+        BOOST_CHECK_THROW(eclWriter.enableAsyncOutput(0), std::invalid_argument);
+
+        eclWriter.writeInitial();
+        if (async) {
+            eclWriter.enableAsyncOutput(2);
+        }
+
+        using measure = UnitSystem::measure;
+        using TargetType = data::TargetType;
+        const auto start_time = ecl_util_make_date( 10, 10, 2008 );
+
+        data::Wells wells;
+        data::WellBlockAveragePressures wbp;
+        data::GroupAndNetworkValues grp_nwrk;
+        Action::State action_state;
+        WellTestState wtest_state;
+        UDQState udq_state(1);
+
+        auto write_step = [&](const int report_step, const bool substep, const double elapsed)
+        {
+            eclWriter.summary().eval(st, report_step, elapsed, wells, wbp, grp_nwrk,
+                                     {{ "FPR", 100.0*report_step + (substep ? 0.5 : 0.0) }},
+                                     {}, {});
+
+            data::Solution sol = createBlackoilState(report_step, 3 * 3 * 3);
+            sol.insert("KRO", measure::identity, std::vector<double>(3*3*3, report_step), TargetType::RESTART_AUXILIARY);
+            sol.insert("KRG", measure::identity, std::vector<double>(3*3*3, report_step*10), TargetType::RESTART_AUXILIARY);
+
+            eclWriter.writeTimeStep(action_state,
+                                    wtest_state,
+                                    st,
+                                    udq_state,
+                                    report_step,
+                                    substep,
+                                    elapsed,
+                                    RestartValue(sol, wells, grp_nwrk, {}));
+        };
+
+        for (int i = 1; i < 6; ++i) {
+            const auto step_time = static_cast<double>(ecl_util_make_date(10 + i, 11, 2008) - start_time);
+            write_step(i, true, step_time - 0.5*unit::day);
+            write_step(i, false, step_time);
+
+            // The caller is free to update its own state while output is
+            // pending.
+            st.update("FPR", -1.0);
+        }
+
+        eclWriter.waitForOutput();
+    };
+
+    run("SYNC", false);
+    run("FOO", true);
+
+    checkRestartFile(5);
+
+    const EclIO::ERst rstFile { "FOO.UNRST" };
+    for (int i = 1; i < 6; ++i) {
+        BOOST_CHECK_MESSAGE(rstFile.hasReportStepNumber(i),
+                            "Restart file must have report step " << i);
+    }
+
+    // Asynchronous output must write the same summary vectors and MINISTEP
+    // numbers as synchronous output.
+    const EclIO::ESmry sync_smry { "SYNC.SMSPEC" };
+    const EclIO::ESmry async_smry { "FOO.SMSPEC" };
+
+    BOOST_REQUIRE(sync_smry.keywordList() == async_smry.keywordList());
+    BOOST_CHECK(sync_smry.hasKey("FPR"));
+    for (const auto& key : sync_smry.keywordList()) {
+        const auto& expect = sync_smry.get(key);
+        const auto& actual = async_smry.get(key);
+        BOOST_CHECK_MESSAGE(expect == actual, "Summary vector " << key << " must match");
+    }
+
+    const auto& fpr = async_smry.get("FPR");
+    BOOST_REQUIRE_EQUAL(fpr.size(), std::size_t{10});
+    BOOST_CHECK_CLOSE(fpr[0], 100.5f, 1.0e-5);
+    BOOST_CHECK_CLOSE(fpr[9], 500.0f, 1.0e-5);
+
+    auto ministeps = [](const std::string& unsmry)
+    {
+        EclIO::EclFile file { unsmry };
+        auto steps = std::vector<int>{};
+        const auto arrays = file.getList();
+        for (auto i = 0*arrays.size(); i < arrays.size(); ++i) {
+            if (std::get<0>(arrays[i]) == "MINISTEP") {
+                steps.push_back(file.get<int>(static_cast<int>(i)).front());
+            }
+        }
+
+        return steps;
+    };
+
+    const auto sync_ministeps = ministeps("SYNC.UNSMRY");
+    BOOST_CHECK_EQUAL(sync_ministeps.size(), std::size_t{10});
+    BOOST_CHECK_EQUAL(sync_ministeps.back(), 9);
+
+    const auto async_ministeps = ministeps("FOO.UNSMRY");
+    BOOST_CHECK_EQUAL_COLLECTIONS(async_ministeps.begin(), async_ministeps.end(),
+                                  sync_ministeps.begin(), sync_ministeps.end());
+}
+
 namespace {
 
 std::pair<std::string,std::array<std::array<std::vector<float>,2>,3>>
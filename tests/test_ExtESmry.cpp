@@ -30,9 +30,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <math.h>
 #include <stdio.h>
 #include <tuple>
@@ -383,3 +385,56 @@ BOOST_AUTO_TEST_CASE(TestESmry_3) {
     for (size_t n = 63; n < fopt.size(); n++)
         BOOST_REQUIRE_CLOSE(fopt[n], fopt_rst_ref[n-63], 0.01);
 }
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_refresh) {
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    std::vector<char> unsmry;
+    {
+        std::ifstream is("SPE1CASE1.UNSMRY", std::ios::binary);
+        unsmry.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    }
+
+    // ESMRY file of an active run, before and after it has progressed
+    {
+        std::ofstream os("SPE1CASE1.UNSMRY", std::ios::binary | std::ios::trunc);
+        os.write(unsmry.data(), unsmry.size() / 2);
+    }
+
+    ESmry("SPE1CASE1.SMSPEC").make_esmry_file();
+
+    ExtESmry esmry("SPE1CASE1.ESMRY");
+    const auto nInitial = esmry.numberOfTimeSteps();
+
+    esmry.get("TIME");
+    esmry.get("WGPR:PROD");
+
+    BOOST_CHECK_EQUAL(esmry.refresh(), 0U);
+
+    {
+        std::ofstream os("SPE1CASE1.UNSMRY", std::ios::binary | std::ios::trunc);
+        os.write(unsmry.data(), unsmry.size());
+    }
+
+    std::filesystem::remove("SPE1CASE1.ESMRY");
+    ESmry("SPE1CASE1.SMSPEC").make_esmry_file();
+
+    ExtESmry ref("SPE1CASE1.ESMRY");
+
+    BOOST_CHECK(nInitial < ref.numberOfTimeSteps());
+    BOOST_CHECK_EQUAL(esmry.refresh(), ref.numberOfTimeSteps() - nInitial);
+    BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), ref.numberOfTimeSteps());
+    BOOST_CHECK(esmry.all_steps_available());
+
+    for (const auto* key : { "TIME", "WGPR:PROD", "FGOR" }) {
+        const auto& vect = esmry.get(key);
+        const auto& ref_vect = ref.get(key);
+        BOOST_CHECK_EQUAL_COLLECTIONS(vect.begin(), vect.end(), ref_vect.begin(), ref_vect.end());
+    }
+
+    const auto rstep = esmry.get_at_rstep("TIME");
+    const auto ref_rstep = ref.get_at_rstep("TIME");
+    BOOST_CHECK_EQUAL_COLLECTIONS(rstep.begin(), rstep.end(), ref_rstep.begin(), ref_rstep.end());
+}
@@ -24,6 +24,7 @@
 #include <opm/io/eclipse/OutputStream.hpp>
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclFileIndex.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
@@ -34,6 +35,8 @@
 #include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <filesystem>
+#include <fstream>
 #include <iterator>
 #include <ostream>
 #include <string>
@@ -1088,6 +1091,117 @@ BOOST_AUTO_TEST_CASE(Formatted_Separate)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_ArrayIndex)
+{
+    const auto rset  = RSet("CASE");
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted { false };
+    const auto unif  = ::Opm::EclIO::OutputStream::Unified   { true };
+    const auto index = ::Opm::EclIO::OutputStream::ArrayIndex{ true };
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    const auto idxName = ::Opm::EclIO::EclFileIndex::indexFileName(fname);
+
+    for (const auto seqnum : { 1, 2, 3 }) {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif, index
+        };
+
+        rst.write("I", std::vector<int>        (seqnum, seqnum));
+        rst.write("S", std::vector<float>      (1234, 1.5f*seqnum));
+        rst.message("STARTSOL");
+        rst.write("D", std::vector<double>     {2.71, 8.21});
+        rst.write("Z", std::vector<std::string>{"W1", "LONG_WELL_NAME"});
+        rst.message("ENDSOL");
+    }
+
+    {
+        auto idx = ::Opm::EclIO::EclFileIndex::load(fname);
+        BOOST_REQUIRE(idx.has_value());
+        BOOST_CHECK_EQUAL(idx->size(), std::size_t{3 * 7});
+    }
+
+    // Overwrite report step 2, existing index must be truncated and
+    // extended, not rebuilt.
+    {
+        const auto seqnum = 2;
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif
+        };
+
+        rst.write("I", std::vector<int>        {17, 29});
+        rst.write("S", std::vector<float>      {3.1f, 4.1f});
+    }
+
+    auto check_restart = [](const std::string& filename)
+    {
+        auto rst = ::Opm::EclIO::ERst{filename};
+
+        const auto seqnum        = rst.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int>{1, 2};
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+
+        const auto vectors        = rst.listOfRstArrays(1);
+        const auto expect_vectors = std::vector<Opm::EclIO::EclFile::EclEntry>{
+            Opm::EclIO::EclFile::EclEntry{"SEQNUM", Opm::EclIO::eclArrType::INTE, 1},
+            Opm::EclIO::EclFile::EclEntry{"I", Opm::EclIO::eclArrType::INTE, 1},
+            Opm::EclIO::EclFile::EclEntry{"S", Opm::EclIO::eclArrType::REAL, 1234},
+            Opm::EclIO::EclFile::EclEntry{"STARTSOL", Opm::EclIO::eclArrType::MESS, 0},
+            Opm::EclIO::EclFile::EclEntry{"D", Opm::EclIO::eclArrType::DOUB, 2},
+            Opm::EclIO::EclFile::EclEntry{"Z", Opm::EclIO::eclArrType::C0NN, 2},
+            Opm::EclIO::EclFile::EclEntry{"ENDSOL", Opm::EclIO::eclArrType::MESS, 0},
+        };
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(vectors.begin(), vectors.end(),
+                                      expect_vectors.begin(),
+                                      expect_vectors.end());
+
+        const auto& S = rst.getRestartData<float>("S", 1, 0);
+        BOOST_CHECK_EQUAL(S.size(), std::size_t{1234});
+        BOOST_CHECK_CLOSE(S.back(), 1.5f, 1.0e-7f);
+
+        // Z is a C0NN array, so look it up by index within step 1.
+        const auto& Z = rst.getRestartData<std::string>(5, 1);
+        BOOST_CHECK_EQUAL(Z.back(), "LONG_WELL_NAME");
+
+        const auto& I = rst.getRestartData<int>("I", 2, 0);
+        const auto  expect_I = std::vector<int>{ 17, 29 };
+        BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                      expect_I.begin(),
+                                      expect_I.end());
+    };
+
+    // Through index
+    BOOST_CHECK(::Opm::EclIO::EclFileIndex::load(fname).has_value());
+    check_restart(fname);
+
+    // Through header scan
+    std::filesystem::remove(idxName);
+    check_restart(fname);
+
+    // Index recreated from scanned file matches file contents
+    ::Opm::EclIO::EclFile{fname}.writeIndex();
+    {
+        auto idx = ::Opm::EclIO::EclFileIndex::load(fname);
+        BOOST_REQUIRE(idx.has_value());
+        BOOST_CHECK_EQUAL(idx->size(), std::size_t{7 + 3});
+        BOOST_CHECK_EQUAL(idx->entries()[7].name, "SEQNUM");
+        BOOST_CHECK_EQUAL(idx->entries()[7].value, 2);
+    }
+    check_restart(fname);
+
+    // Index is ignored once the data file changes
+    {
+        std::ofstream os(fname, std::ios::app | std::ios::binary);
+        os << "garbage";
+    }
+    BOOST_CHECK(! ::Opm::EclIO::EclFileIndex::load(fname).has_value());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Class_Restart
 
 // ==========================================================================
@@ -36,6 +36,9 @@
 
 #include <opm/input/eclipse/Python/Python.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
+#include <opm/input/eclipse/Schedule/Action/Actions.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
@@ -60,11 +63,14 @@
 #include <ctime>
 #include <exception>
 #include <filesystem>
+#include <fstream>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -72,6 +78,10 @@
 
 #include <fmt/format.h>
 
+#if _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Opm;
 using rt = data::Rates::opt;
 using p_cmode = Opm::Group::ProductionCMode;
@@ -2866,6 +2876,345 @@ BOOST_AUTO_TEST_CASE(efficiency_factor) {
         BOOST_CHECK_CLOSE( 200.1 * 0.2 * 0.01, ecl_sum_get_well_connection_var( resp, 1, "W_2", "COPT", 2, 1, 1 ), 1e-5 );
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_block_variables)
+{
+    // Request BPR and BSWAT in every cell, i.e., more than 1024 vectors
+    // which are evaluated concurrently.
+    auto deck_string = []()
+    {
+        std::ifstream is("summary_deck.DATA");
+        std::ostringstream buffer;
+        buffer << is.rdbuf();
+        return buffer.str();
+    }();
+
+    std::string block_vectors;
+    for (const auto* vector : { "BPR", "BSWAT" }) {
+        block_vectors += fmt::format("{}\n", vector);
+        for (int k = 1; k <= 10; ++k) {
+            for (int j = 1; j <= 10; ++j) {
+                for (int i = 1; i <= 10; ++i) {
+                    block_vectors += fmt::format(" {} {} {} /\n", i, j, k);
+                }
+            }
+        }
+        block_vectors += "/\n";
+    }
+
+    const auto summary_pos = deck_string.find("\nSUMMARY\n");
+    BOOST_REQUIRE(summary_pos != std::string::npos);
+    deck_string.insert(summary_pos + std::string_view { "\nSUMMARY\n" }.size(), block_vectors);
+
+    const auto deck = Parser{}.parseString(deck_string);
+    const EclipseState es { deck };
+    const Schedule schedule { deck, es, std::make_shared<Python>() };
+    SummaryConfig config { deck, schedule, es.fieldProps(), es.aquifer() };
+    const auto wells = result_wells();
+    const auto grp_nwrk = result_group_nwrk();
+    const data::WellBlockAveragePressures wbp{};
+
+    WorkArea ta { "summary_test" };
+
+    out::Summary::BlockValues block_values;
+    for (std::size_t g = 0; g < es.getInputGrid().getCartesianSize(); ++g) {
+        block_values[std::make_pair("BPR", static_cast<int>(g) + 1)] = (1.0 + 0.001*g) * barsa();
+        if (g % 2 == 0) {
+            block_values[std::make_pair("BSWAT", static_cast<int>(g) + 1)] = 0.0001 * g;
+        }
+    }
+
+    out::Summary writer(config, es, es.getInputGrid(), schedule, "CONCURRENT");
+
+    auto evaluate = [&](const int num_threads)
+    {
+#if _OPENMP
+        omp_set_num_threads(num_threads);
+#else
+        static_cast<void>(num_threads);
+#endif
+
+        SummaryState st(TimeService::now(), es.runspec().udqParams().undefinedValue());
+        for (int step = 1; step <= 2; ++step) {
+            writer.eval(st, step, step * day, wells, wbp, grp_nwrk, {}, {}, {}, {}, block_values);
+        }
+
+        return st;
+    };
+
+    const auto serial = evaluate(1);
+    const auto concurrent = evaluate(4);
+
+    auto num_values = std::size_t{0};
+    for (const auto& [key, value] : serial) {
+        ++num_values;
+        BOOST_REQUIRE_MESSAGE(concurrent.has(key), "Concurrent evaluation must produce " << key);
+        BOOST_CHECK_MESSAGE(concurrent.get(key) == value,
+                            "Concurrent evaluation of " << key << " must match serial evaluation");
+    }
+
+    BOOST_CHECK_EQUAL(num_values, static_cast<std::size_t>(std::distance(concurrent.begin(), concurrent.end())));
+    BOOST_CHECK_GT(num_values, std::size_t{1024});
+
+    BOOST_CHECK_CLOSE(concurrent.get("BPR:1,1,1"), 1.0, 1.0e-8);
+    BOOST_CHECK_CLOSE(concurrent.get("BPR:10,10,10"), 1.999, 1.0e-8);
+}
+
+BOOST_AUTO_TEST_CASE(step_plans_follow_schedule_changes)
+{
+    const auto deck = Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 3 3 1 /
+OIL
+WATER
+GAS
+METRIC
+START
+ 1 'JAN' 2020 /
+WELLDIMS
+ 4 1 2 4 /
+GRID
+DXV
+ 3*100 /
+DYV
+ 3*100 /
+DZV
+ 10 /
+TOPS
+ 9*2000 /
+PORO
+ 9*0.3 /
+PERMX
+ 9*100 /
+PERMY
+ 9*100 /
+PERMZ
+ 9*10 /
+SUMMARY
+FOPR
+GOPR
+ 'G1' 'G2' /
+WOPR
+/
+SCHEDULE
+WELSPECS
+ 'P1' 'G1' 1 1 1* 'OIL' /
+ 'P2' 'G1' 2 2 1* 'OIL' /
+ 'P3' 'G2' 3 3 1* 'OIL' /
+/
+COMPDAT
+ 'P1' 2* 1 1 'OPEN' /
+ 'P2' 2* 1 1 'OPEN' /
+ 'P3' 2* 1 1 'OPEN' /
+/
+WCONPROD
+ 'P1' 'OPEN' 'ORAT' 100 /
+ 'P2' 'OPEN' 'ORAT' 100 /
+ 'P3' 'OPEN' 'ORAT' 100 /
+/
+WEFAC
+ 'P1' 0.5 /
+/
+GEFAC
+ 'G1' 0.8 /
+/
+TSTEP
+ 1 /
+-- P2 moves to G2
+WELSPECS
+ 'P2' 'G2' 2 2 1* 'OIL' /
+/
+TSTEP
+ 1 /
+WELOPEN
+ 'P1' 'SHUT' /
+/
+TSTEP
+ 1 /
+WELSPECS
+ 'P4' 'G1' 1 3 1* 'OIL' /
+/
+COMPDAT
+ 'P4' 2* 1 1 'OPEN' /
+/
+WCONPROD
+ 'P4' 'OPEN' 'ORAT' 100 /
+/
+TSTEP
+ 1 /
+)");
+
+    const EclipseState es { deck };
+    const Schedule schedule { deck, es, std::make_shared<Python>() };
+    SummaryConfig config { deck, schedule, es.fieldProps(), es.aquifer() };
+    const data::WellBlockAveragePressures wbp{};
+    const data::GroupAndNetworkValues grp_nwrk{};
+
+    WorkArea ta { "summary_test" };
+
+    data::Wells wells;
+    const std::map<std::string, double> oil_rates {
+        { "P1", 10.0 }, { "P2", 20.0 }, { "P3", 30.0 }, { "P4", 40.0 },
+    };
+    for (const auto& [name, rate] : oil_rates) {
+        wells[name].rates.set(rt::oil, -rate / day);
+    }
+
+    const std::vector<std::string> keys {
+        "FOPR", "GOPR:G1", "GOPR:G2", "WOPR:P1", "WOPR:P2", "WOPR:P3", "WOPR:P4",
+    };
+
+    // One Summary object through all report steps, with two ministeps per
+    // step, reuses the evaluation plan of a step until the step changes.
+    out::Summary cached(config, es, es.getInputGrid(), schedule, "CACHED");
+    SummaryState cached_st(TimeService::now(), es.runspec().udqParams().undefinedValue());
+
+    std::vector<double> gopr_g2;
+    for (int step = 1; step <= 4; ++step) {
+        cached.eval(cached_st, step, (step - 0.5) * day, wells, wbp, grp_nwrk, {}, {}, {}, {});
+        cached.eval(cached_st, step, step * day, wells, wbp, grp_nwrk, {}, {}, {}, {});
+
+        // A fresh Summary object builds its plan for this step only.
+        out::Summary fresh(config, es, es.getInputGrid(), schedule, "FRESH");
+        SummaryState fresh_st(TimeService::now(), es.runspec().udqParams().undefinedValue());
+        fresh.eval(fresh_st, step, step * day, wells, wbp, grp_nwrk, {}, {}, {}, {});
+
+        for (const auto& key : keys) {
+            BOOST_CHECK_EQUAL(cached_st.has(key), fresh_st.has(key));
+            if (fresh_st.has(key)) {
+                BOOST_CHECK_MESSAGE(cached_st.get(key) == fresh_st.get(key),
+                                    "Cached evaluation of " << key << " at report step "
+                                    << step << " must match fresh evaluation");
+            }
+        }
+
+        gopr_g2.push_back(cached_st.get("GOPR:G2"));
+    }
+
+    // The membership change of P2 is visible in the G2 rate.
+    BOOST_CHECK_CLOSE(gopr_g2[0], 30.0, 1.0e-8);
+    BOOST_CHECK_CLOSE(gopr_g2[1], 50.0, 1.0e-8);
+}
+
+BOOST_AUTO_TEST_CASE(step_plans_follow_schedule_changes_within_step)
+{
+    const auto deck = Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 3 3 1 /
+OIL
+WATER
+GAS
+METRIC
+START
+ 1 'JAN' 2020 /
+WELLDIMS
+ 3 1 2 3 /
+GRID
+DXV
+ 3*100 /
+DYV
+ 3*100 /
+DZV
+ 10 /
+TOPS
+ 9*2000 /
+PORO
+ 9*0.3 /
+PERMX
+ 9*100 /
+PERMY
+ 9*100 /
+PERMZ
+ 9*10 /
+SUMMARY
+FOPR
+GOPR
+ 'G1' 'G2' /
+SCHEDULE
+WELSPECS
+ 'P1' 'G1' 1 1 1* 'OIL' /
+ 'P2' 'G1' 2 2 1* 'OIL' /
+ 'P3' 'G2' 3 3 1* 'OIL' /
+/
+COMPDAT
+ 'P1' 2* 1 1 'OPEN' /
+ 'P2' 2* 1 1 'OPEN' /
+ 'P3' 2* 1 1 'OPEN' /
+/
+WCONPROD
+ 'P1' 'OPEN' 'ORAT' 100 /
+ 'P2' 'OPEN' 'ORAT' 100 /
+ 'P3' 'OPEN' 'ORAT' 100 /
+/
+ACTIONX
+ 'MOVE' /
+ WOPR 'P3' > 1000 /
+/
+WELSPECS
+ 'P3' 'G1' 3 3 1* 'OIL' /
+/
+WEFAC
+ 'P1' 0.5 /
+/
+ENDACTIO
+TSTEP
+ 1 1 /
+)");
+
+    const EclipseState es { deck };
+    Schedule schedule { deck, es, std::make_shared<Python>() };
+    SummaryConfig config { deck, schedule, es.fieldProps(), es.aquifer() };
+    const data::WellBlockAveragePressures wbp{};
+    const data::GroupAndNetworkValues grp_nwrk{};
+
+    WorkArea ta { "summary_test" };
+
+    data::Wells wells;
+    const std::map<std::string, double> oil_rates {
+        { "P1", 10.0 }, { "P2", 20.0 }, { "P3", 30.0 },
+    };
+    for (const auto& [name, rate] : oil_rates) {
+        wells[name].rates.set(rt::oil, -rate / day);
+    }
+
+    const auto undefined = es.runspec().udqParams().undefinedValue();
+
+    out::Summary cached(config, es, es.getInputGrid(), schedule, "CACHED");
+    SummaryState cached_st(TimeService::now(), undefined);
+
+    // First ministep of report step 1 builds the step plans.
+    cached.eval(cached_st, 1, 0.5 * day, wells, wbp, grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_CLOSE(cached_st.get("GOPR:G1"), 30.0, 1.0e-8);
+    BOOST_CHECK_CLOSE(cached_st.get("GOPR:G2"), 30.0, 1.0e-8);
+    BOOST_CHECK_CLOSE(cached_st.get("FOPR"), 60.0, 1.0e-8);
+
+    // Action triggered within report step 1: P3 joins G1 and P1's
+    // efficiency factor changes.  The plans must be rebuilt even though
+    // the report step is the same.
+    const auto revision = schedule.revision();
+    schedule.applyAction(1, schedule[1].actions()["MOVE"],
+                         Action::Result{true}.matches(),
+                         std::unordered_map<std::string, double>{});
+    BOOST_CHECK(schedule.revision() != revision);
+
+    cached.eval(cached_st, 1, 1.0 * day, wells, wbp, grp_nwrk, {}, {}, {}, {});
+
+    out::Summary fresh(config, es, es.getInputGrid(), schedule, "FRESH");
+    SummaryState fresh_st(TimeService::now(), undefined);
+    fresh.eval(fresh_st, 1, 1.0 * day, wells, wbp, grp_nwrk, {}, {}, {}, {});
+
+    for (const auto* key : { "FOPR", "GOPR:G1", "GOPR:G2" }) {
+        BOOST_CHECK_EQUAL(cached_st.has(key), fresh_st.has(key));
+        if (fresh_st.has(key)) {
+            BOOST_CHECK_MESSAGE(cached_st.get(key) == fresh_st.get(key),
+                                "Cached evaluation of " << key << " after an action "
+                                "within the report step must match fresh evaluation");
+        }
+    }
+
+    BOOST_CHECK_CLOSE(cached_st.get("GOPR:G1"), 55.0, 1.0e-8);
+    BOOST_CHECK_CLOSE(cached_st.get("FOPR"), 55.0, 1.0e-8);
+}
+
 BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     Opm::SummaryState st(TimeService::now(), 0.0);
     st.update("WWCT:OP_2", 100);
@@ -6632,10 +6981,13 @@ BOOST_AUTO_TEST_CASE(SummaryState_TOTAL) {
     st.update_well_var("OP1", "WWCT", 0.50);
     BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WWCT"), 0.50);
 
+    // WOPT:OP1 is the same value whether it is updated through the
+    // general key or as a well variable.
     st.update_well_var("OP1", "WOPT", 100);
-    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 100);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 300);
     st.update_well_var("OP1", "WOPT", 100);
-    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 200);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 400);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 400);
 
     st.update_well_var("OP1", "WOPTH", 100);
     BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPTH"), 100);
@@ -6687,4 +7039,162 @@ BOOST_AUTO_TEST_CASE(append_summary_state) {
     BOOST_CHECK_EQUAL(st_both.get_group_var("G1", "WOPR"), 3000);
 }
 
+BOOST_AUTO_TEST_CASE(summary_state_slots) {
+    SummaryState st(TimeService::now(), -1.0);
+
+    const auto fopr = st.intern("FOPR");
+    const auto fopt = st.intern("FOPT");
+    BOOST_CHECK_EQUAL(st.intern("FOPR"), fopr);
+    BOOST_CHECK_EQUAL(st.slot_key(fopt), "FOPT");
+
+    // Interning does not define a value.
+    BOOST_CHECK(!st.has_slot(fopr));
+    BOOST_CHECK(!st.has("FOPR"));
+    BOOST_CHECK_THROW(st.get_slot(fopr), std::out_of_range);
+    BOOST_CHECK_EQUAL(st.get_slot(fopr, 1.5), 1.5);
+    BOOST_CHECK_EQUAL(st.size(), 0);
+
+    st.update_slot(fopr, 100);
+    st.update_slot(fopr, 50);
+    st.update_slot(fopt, 100);
+    st.update_slot(fopt, 50);
+    BOOST_CHECK_EQUAL(st.get("FOPR"), 50);
+    BOOST_CHECK_EQUAL(st.get("FOPT"), 150);
+
+    // String based updates go to the same slot.
+    st.update_well_var("OP1", "WOPR", 10);
+    const auto wopr = st.find_slot("WOPR:OP1");
+    BOOST_REQUIRE(wopr.has_value());
+    BOOST_CHECK_EQUAL(st.get_slot(*wopr), 10);
+    BOOST_CHECK(!st.find_slot("WOPR:OP2").has_value());
+
+    // UDQs have a fallback value when not defined.
+    const auto fu = st.intern("FU_X");
+    BOOST_CHECK(st.has_slot(fu));
+    BOOST_CHECK_EQUAL(st.get_slot(fu), -1.0);
+
+    BOOST_CHECK_EQUAL(st.size(), 3);
+
+    // Copies share slots, and diverge once either side interns a key.
+    const auto id = st.key_table_id();
+    auto copy = st;
+    BOOST_CHECK_EQUAL(copy.key_table_id(), id);
+    BOOST_CHECK_EQUAL(copy.get_slot(fopt), 150);
+
+    copy.update("FWPR", 1.0);
+    BOOST_CHECK(copy.key_table_id() != id);
+    BOOST_CHECK_EQUAL(st.key_table_id(), id);
+    BOOST_CHECK(!st.find_slot("FWPR").has_value());
+    BOOST_CHECK_EQUAL(copy.get_slot(fopt), 150);
+
+    // Erased keys are removed from the key table, and the slot is reused
+    // by the next key interned.
+    const auto num_slots = st.num_slots();
+    BOOST_CHECK(st.erase("FOPR"));
+    BOOST_CHECK(!st.has_slot(fopr));
+    BOOST_CHECK(!st.find_slot("FOPR").has_value());
+    BOOST_CHECK_EQUAL(st.size(), 2);
+    BOOST_CHECK(st.key_table_id() != id);
+    BOOST_CHECK_EQUAL(copy.find_slot("FOPR").value(), fopr);
+    BOOST_CHECK_EQUAL(copy.get_slot(fopr), 50);
+
+    const auto fgpr = st.intern("FGPR");
+    BOOST_CHECK_EQUAL(fgpr, fopr);
+    BOOST_CHECK(!st.has_slot(fgpr));
+    BOOST_CHECK_EQUAL(st.num_slots(), num_slots);
+
+    // Iteration visits the defined values only.
+    SummaryState reordered(TimeService::now(), -1.0);
+    reordered.update_well_var("OP1", "WOPR", 10);
+    reordered.update("FOPT", 150);
+    std::size_t num_values = 0;
+    for (const auto& [key, value] : st) {
+        BOOST_CHECK_EQUAL(reordered.get(key), value);
+        ++num_values;
+    }
+    BOOST_CHECK_EQUAL(num_values, st.size());
+}
+
+BOOST_AUTO_TEST_CASE(summary_state_variable_slots) {
+    SummaryState st(TimeService::now(), -1.0);
+
+    // Values stored through the slot of a specialised variable are seen by
+    // the specialised accessors.
+    const auto wopt = st.well_var_slot("OP1", "WOPT");
+    BOOST_CHECK_EQUAL(st.well_var_slot("OP1", "WOPT"), wopt);
+    BOOST_CHECK_EQUAL(st.find_slot("WOPT:OP1").value(), wopt);
+    BOOST_CHECK(!st.has_well_var("OP1", "WOPT"));
+    BOOST_CHECK(st.wells().empty());
+
+    st.update_slot(wopt, 100);
+    st.update_slot(wopt, 50);
+    BOOST_CHECK(st.has_well_var("OP1", "WOPT"));
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 150);
+    BOOST_CHECK_EQUAL(st.wells().size(), 1U);
+    BOOST_CHECK_EQUAL(st.wells("WOPT").size(), 1U);
+
+    const auto copr = st.conn_var_slot("OP1", "COPR", 7);
+    st.update_slot(copr, 12);
+    BOOST_CHECK_EQUAL(st.get_conn_var("OP1", "COPR", 7), 12);
+    BOOST_CHECK_EQUAL(st.get("COPR:OP1:7"), 12);
+
+    const auto sofr = st.segment_var_slot("OP1", "SOFR", 3);
+    st.update_slot(sofr, 5);
+    BOOST_CHECK_EQUAL(st.get_segment_var("OP1", "SOFR", 3), 5);
+
+    const auto rpr = st.region_var_slot("FIPABC", "RPR", 2);
+    st.update_slot(rpr, 250);
+    BOOST_CHECK_EQUAL(st.get_region_var("FIPABC", "RPR", 2), 250);
+    BOOST_CHECK_EQUAL(st.get("RPR__ABC:2"), 250);
+
+    // The general and specialised accessors share the value.
+    st.set("WOPT:OP1", 10);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 10);
+
+    // Erasing a specialised variable removes its key and its slot entry.
+    const auto id = st.key_table_id();
+    BOOST_CHECK(st.erase_well_var("OP1", "WOPT"));
+    BOOST_CHECK(st.key_table_id() != id);
+    BOOST_CHECK(!st.has("WOPT:OP1"));
+    BOOST_CHECK(!st.find_slot("WOPT:OP1").has_value());
+    BOOST_CHECK(!st.has_well_var("OP1", "WOPT"));
+    BOOST_CHECK(st.wells().empty());
+    BOOST_CHECK(!st.erase_well_var("OP1", "WOPT"));
+
+    st.update_well_var("OP1", "WOPT", 7);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 7);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 7);
+}
+
+BOOST_AUTO_TEST_CASE(summary_state_shared_key_table) {
+    SummaryState st(TimeService::now(), -1.0);
+    st.update("FOPR", 1.0);
+    const auto fopr = st.find_slot("FOPR").value();
+
+    // A copy read on another thread keeps its key table while the source
+    // keeps adding keys, whenever the copy is destroyed.
+    auto modified = false;
+    auto reader = std::thread {
+        [snapshot = SummaryState { st }, fopr, &modified]()
+        {
+            for (auto i = 0; i < 1000; ++i) {
+                modified = modified
+                    || (snapshot.get_slot(fopr) != 1.0)
+                    || snapshot.find_slot("WOPR:W999").has_value();
+            }
+        }
+    };
+
+    for (auto i = 0; i < 1000; ++i) {
+        st.update(fmt::format("WOPR:W{}", i), i);
+    }
+
+    reader.join();
+
+    BOOST_CHECK(!modified);
+    BOOST_CHECK_EQUAL(st.get("FOPR"), 1.0);
+    BOOST_CHECK_EQUAL(st.get("WOPR:W999"), 999.0);
+    BOOST_CHECK_EQUAL(st.size(), 1001U);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary_State
@@ -38,6 +38,7 @@
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <stdexcept>
@@ -96,6 +97,58 @@ BOOST_AUTO_TEST_CASE(create)
     BOOST_CHECK( cmp_list(regCache.wells("FIPNUM", 11), {"W_6"}));
 }
 
+BOOST_AUTO_TEST_CASE(ConnectionTable)
+{
+    const auto  deck     = summaryDeck();
+    const auto  es       = Opm::EclipseState { deck };
+    const auto  schedule = Opm::Schedule { deck, es, std::make_shared<Opm::Python>() };
+    const auto& grid     = es.getInputGrid();
+
+    const auto regCache = Opm::out::RegionCache {
+        {"FIPNUM"}, es.fieldProps(), grid, schedule
+    };
+
+    BOOST_CHECK(regCache.connectionTable("FIPXYZ") == nullptr);
+
+    const auto& wells = regCache.wellNames();
+    BOOST_CHECK(std::is_sorted(wells.begin(), wells.end()));
+    BOOST_CHECK(std::find(wells.begin(), wells.end(), "W_1") != wells.end());
+    BOOST_CHECK(std::find(wells.begin(), wells.end(), "W_6") != wells.end());
+
+    const auto* table = regCache.connectionTable("FIPNUM");
+    BOOST_REQUIRE(table != nullptr);
+    BOOST_REQUIRE(table->start.size() >= std::size_t{2});
+
+    const auto numConn = table->start.back();
+    BOOST_CHECK_EQUAL(table->well.size(), numConn);
+    BOOST_CHECK_EQUAL(table->cell.size(), numConn);
+    BOOST_CHECK_EQUAL(table->conn.size(), numConn);
+
+    // Region 1 has four connections, starting with W_1 in cell (0,0,0).
+    BOOST_CHECK_EQUAL(table->start[2] - table->start[1], std::size_t{4});
+    BOOST_CHECK_EQUAL(wells[table->well[table->start[1]]], "W_1");
+    BOOST_CHECK_EQUAL(table->cell[table->start[1]], grid.getGlobalIndex(0, 0, 0));
+
+    // Same connections, in the same order, as the per region lists.
+    for (auto region = 0*table->start.size(); region + 1 < table->start.size(); ++region) {
+        const auto& conns = regCache.connections("FIPNUM", static_cast<int>(region));
+        BOOST_REQUIRE_EQUAL(table->start[region + 1] - table->start[region], conns.size());
+
+        for (auto i = 0*conns.size(); i < conns.size(); ++i) {
+            const auto ix = table->start[region] + i;
+
+            BOOST_CHECK_EQUAL(wells[table->well[ix]], conns[i].first);
+            BOOST_CHECK_EQUAL(table->cell[ix], conns[i].second);
+
+            const auto& wconn = schedule.back().wells(conns[i].first).getConnections();
+            BOOST_REQUIRE(table->conn[ix] < wconn.size());
+            BOOST_CHECK_EQUAL(wconn[table->conn[ix]].global_index(), conns[i].second);
+        }
+    }
+
+    BOOST_CHECK(regCache.connections("FIPNUM", static_cast<int>(table->start.size() - 1)).empty());
+}
+
 BOOST_AUTO_TEST_CASE(InactiveLayers)
 {
     const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC